@@ -4139,6 +4139,30 @@ class V8_EXPORT HeapStatistics {
 };
 
 
+/**
+ * Time and zone memory spent in one phase of one compiler tier, accumulated
+ * over all compilations of an isolate. Only collected with --compile-stats.
+ */
+class V8_EXPORT CompilePhaseStatistics {
+ public:
+  CompilePhaseStatistics();
+  const char* tier() { return tier_; }
+  const char* phase() { return phase_; }
+  int count() { return count_; }
+  double time_in_ms() { return time_in_ms_; }
+  size_t zone_bytes() { return zone_bytes_; }
+
+ private:
+  const char* tier_;
+  const char* phase_;
+  int count_;
+  double time_in_ms_;
+  size_t zone_bytes_;
+
+  friend class Isolate;
+};
+
+
 class RetainedObjectInfo;
 
 /**
@@ -4318,6 +4342,19 @@ class V8_EXPORT Isolate {
    */
   void GetHeapStatistics(HeapStatistics* heap_statistics);
 
+  /**
+   * Returns the number of compiler phases with recorded statistics. Phases
+   * are only recorded when V8 runs with --compile-stats.
+   */
+  int NumberOfCompilePhases();
+
+  /**
+   * Get the statistics of the compiler phase at |index|. Returns false if
+   * |index| is out of range.
+   */
+  bool GetCompilePhaseStatistics(int index,
+                                 CompilePhaseStatistics* phase_statistics);
+
   /**
    * Adjusts the amount of registered external memory. Used to give V8 an
    * indication of the amount of externally allocated memory that is kept alive
@@ -5695,7 +5732,7 @@ class Internals {
   static const int kNullValueRootIndex = 7;
   static const int kTrueValueRootIndex = 8;
   static const int kFalseValueRootIndex = 9;
-  static const int kEmptyStringRootIndex = 164;
+  static const int kEmptyStringRootIndex = 165;
 
   // The external allocation limit should be below 256 MB on all architectures
   // to avoid that resource-constrained embedders run low on memory.
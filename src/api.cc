@@ -5055,6 +5055,13 @@ HeapStatistics::HeapStatistics(): total_heap_size_(0),
                                   heap_size_limit_(0) { }
 
 
+CompilePhaseStatistics::CompilePhaseStatistics(): tier_(NULL),
+                                                  phase_(NULL),
+                                                  count_(0),
+                                                  time_in_ms_(0),
+                                                  zone_bytes_(0) { }
+
+
 void v8::V8::VisitExternalResources(ExternalResourceVisitor* visitor) {
   i::Isolate* isolate = i::Isolate::Current();
   isolate->heap()->VisitExternalResources(visitor);
@@ -6672,6 +6679,30 @@ void Isolate::GetHeapStatistics(HeapStatistics* heap_statistics) {
 }
 
 
+int Isolate::NumberOfCompilePhases() {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!isolate->IsInitialized()) return 0;
+  return isolate->compilation_statistics()->NumberOfPhases();
+}
+
+
+bool Isolate::GetCompilePhaseStatistics(
+    int index, CompilePhaseStatistics* phase_statistics) {
+  i::Isolate* isolate = reinterpret_cast<i::Isolate*>(this);
+  if (!isolate->IsInitialized()) return false;
+  i::CompilationStatistics::PhaseStats stats;
+  if (!isolate->compilation_statistics()->GetPhase(index, &stats)) {
+    return false;
+  }
+  phase_statistics->tier_ = i::CompilationStatistics::TierName(stats.tier);
+  phase_statistics->phase_ = stats.phase;
+  phase_statistics->count_ = stats.count;
+  phase_statistics->time_in_ms_ = stats.time.InMillisecondsF();
+  phase_statistics->zone_bytes_ = stats.zone_bytes;
+  return true;
+}
+
+
 void Isolate::SetEventLogger(LogEventCallback that) {
   // Do not overwrite the event logger if we want to log explicitly.
   if (i::FLAG_log_timer_events) return;
@@ -6771,6 +6802,7 @@ void v8::Isolate::LowMemoryNotification() {
         isolate->counters()->gc_low_memory_notification());
     isolate->heap()->CollectAllAvailableGarbage("low memory notification");
   }
+  i::ZoneSegmentPool::ReleaseUnusedSegments();
 }
 
 
@@ -829,7 +829,8 @@ function ArraySort(comparefn) {
   // In-place QuickSort algorithm.
   // For short (length <= 22) arrays, insertion sort is used for efficiency.
 
-  if (!IS_SPEC_FUNCTION(comparefn)) {
+  var use_default_order = !IS_SPEC_FUNCTION(comparefn);
+  if (use_default_order) {
     comparefn = function (x, y) {
       if (x === y) return 0;
       if (%_IsSmi(x) && %_IsSmi(y)) {
@@ -1098,7 +1099,15 @@ function ArraySort(comparefn) {
     num_non_undefined = SafeRemoveArrayHoles(this);
   }
 
-  QuickSort(this, 0, num_non_undefined);
+  // Arrays of Smis, doubles or strings in the default order are sorted
+  // natively, since the comparisons cannot be observed. User comparators
+  // stay in JavaScript: %_CallFunction compiles to a direct call that the
+  // optimizing compiler can inline, while calling them from C++ would go
+  // through Execution::Call and enter JavaScript once per comparison.
+  if (!is_array || !use_default_order ||
+      !%SortFastElements(this, num_non_undefined)) {
+    QuickSort(this, 0, num_non_undefined);
+  }
 
   if (!is_array && (num_non_undefined + 1 < max_prototype_element)) {
     // For compatibility with JSC, we shadow any elements in the prototype
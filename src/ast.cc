@@ -64,10 +64,10 @@ VariableProxy::VariableProxy(Zone* zone, Variable* var, int position,
     : Expression(zone, position, id_gen),
       name_(var->raw_name()),
       var_(NULL),  // Will be set by the call to BindTo.
-      is_this_(var->is_this()),
-      is_assigned_(false),
       interface_(var->interface()),
-      variable_feedback_slot_(kInvalidFeedbackSlot) {
+      variable_feedback_slot_(kInvalidFeedbackSlot),
+      is_this_(var->is_this()),
+      is_assigned_(false) {
   BindTo(var);
 }
 
@@ -77,10 +77,10 @@ VariableProxy::VariableProxy(Zone* zone, const AstRawString* name, bool is_this,
     : Expression(zone, position, id_gen),
       name_(name),
       var_(NULL),
-      is_this_(is_this),
-      is_assigned_(false),
       interface_(interface),
-      variable_feedback_slot_(kInvalidFeedbackSlot) {}
+      variable_feedback_slot_(kInvalidFeedbackSlot),
+      is_this_(is_this),
+      is_assigned_(false) {}
 
 
 void VariableProxy::BindTo(Variable* var) {
@@ -1115,20 +1115,45 @@ void AstConstructionVisitor::VisitCallRuntime(CallRuntime* node) {
 #undef DONT_CACHE_NODE
 
 
-Handle<String> Literal::ToString() {
-  if (value_->IsString()) return value_->AsString()->string();
+uint32_t Literal::Hash() {
+  // The hash of a number is that of its string form, so that it is the same
+  // as the hash of an equal string literal.
+  if (value_->IsString()) {
+    const AstRawString* string = value_->AsString();
+    if (string->is_one_byte()) {
+      return StringHasher::HashSequentialString(string->raw_data(),
+                                                string->length(), 0);
+    }
+    return StringHasher::HashSequentialString(
+        reinterpret_cast<const uint16_t*>(string->raw_data()),
+        string->length(), 0);
+  }
   DCHECK(value_->IsNumber());
   char arr[100];
   Vector<char> buffer(arr, arraysize(arr));
-  const char* str;
-  if (value()->IsSmi()) {
-    // Optimization only, the heap number case would subsume this.
-    SNPrintF(buffer, "%d", Smi::cast(*value())->value());
-    str = arr;
-  } else {
-    str = DoubleToCString(value()->Number(), buffer);
+  const char* str = DoubleToCString(value_->AsNumber(), buffer);
+  return StringHasher::HashSequentialString(
+      reinterpret_cast<const uint8_t*>(str), StrLength(str), 0);
+}
+
+
+bool Literal::Match(void* literal1, void* literal2) {
+  const AstValue* x = static_cast<Literal*>(literal1)->raw_value();
+  const AstValue* y = static_cast<Literal*>(literal2)->raw_value();
+  if (x->IsString() && y->IsString()) {
+    return AstRawString::Compare(const_cast<AstRawString*>(x->AsString()),
+                                 const_cast<AstRawString*>(y->AsString()));
   }
-  return isolate_->factory()->NewStringFromAsciiChecked(str);
+  if (x->IsString()) std::swap(x, y);
+  DCHECK(x->IsNumber());
+  char arr[100];
+  Vector<char> buffer(arr, arraysize(arr));
+  const char* str = DoubleToCString(x->AsNumber(), buffer);
+  if (y->IsString()) return y->AsString()->IsOneByteEqualTo(str);
+  DCHECK(y->IsNumber());
+  char other_arr[100];
+  Vector<char> other_buffer(other_arr, arraysize(other_arr));
+  return strcmp(str, DoubleToCString(y->AsNumber(), other_buffer)) == 0;
 }
 
 
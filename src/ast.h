@@ -347,14 +347,26 @@ class Expression : public AstNode {
   // True if we can prove that the expression is the undefined literal.
   bool IsUndefinedLiteral(Isolate* isolate) const;
 
-  // Expression type bounds
-  Bounds bounds() const { return bounds_; }
-  void set_bounds(Bounds bounds) { bounds_ = bounds; }
+  // Expression type bounds. They are only computed by the AST typer, so
+  // they are kept out of line and allocated on the first narrowing.
+  Bounds bounds() const {
+    return bounds_ == NULL ? Bounds(Type::None(), Type::Any()) : *bounds_;
+  }
+  void set_bounds(Bounds bounds, Zone* zone) {
+    if (bounds_ == NULL) {
+      bounds_ = new(zone->New(sizeof(Bounds))) Bounds(bounds);
+    } else {
+      *bounds_ = bounds;
+    }
+  }
 
-  // Whether the expression is parenthesized
+  // Whether the expression is parenthesized. The level saturates, callers
+  // only distinguish zero, one and more than one.
   unsigned parenthesization_level() const { return parenthesization_level_; }
   bool is_parenthesized() const { return parenthesization_level_ > 0; }
-  void increase_parenthesization_level() { ++parenthesization_level_; }
+  void increase_parenthesization_level() {
+    if (parenthesization_level_ < kMaxUInt8) ++parenthesization_level_;
+  }
 
   // Type feedback information for assignments and properties.
   virtual bool IsMonomorphic() {
@@ -375,24 +387,26 @@ class Expression : public AstNode {
   byte to_boolean_types() const { return to_boolean_types_; }
 
   BailoutId id() const { return id_; }
-  TypeFeedbackId test_id() const { return test_id_; }
+  TypeFeedbackId test_id() const { return TypeFeedbackId(id_.ToInt() + 1); }
 
  protected:
   Expression(Zone* zone, int pos, IdGen* id_gen)
       : AstNode(pos),
-        bounds_(Bounds::Unbounded(zone)),
+        to_boolean_types_(0),
         parenthesization_level_(0),
-        id_(id_gen->GetNextId()),
-        test_id_(id_gen->GetNextId()) {}
+        bounds_(NULL),
+        id_(id_gen->ReserveIdRange(2)) {}
   void set_to_boolean_types(byte types) { to_boolean_types_ = types; }
 
  private:
-  Bounds bounds_;
+  // The byte-sized fields come first so that they are packed into the
+  // padding after AstNode::position_.
   byte to_boolean_types_;
-  unsigned parenthesization_level_;
+  byte parenthesization_level_;
+  Bounds* bounds_;
 
+  // The test id is the one following id_.
   const BailoutId id_;
-  const TypeFeedbackId test_id_;
 };
 
 
@@ -1369,29 +1383,20 @@ class Literal FINAL : public Expression {
   const AstValue* raw_value() const { return value_; }
 
   // Support for using Literal as a HashMap key. NOTE: Currently, this works
-  // only for string and number literals!
-  uint32_t Hash() { return ToString()->Hash(); }
-
-  static bool Match(void* literal1, void* literal2) {
-    Handle<String> s1 = static_cast<Literal*>(literal1)->ToString();
-    Handle<String> s2 = static_cast<Literal*>(literal2)->ToString();
-    return String::Equals(s1, s2);
-  }
+  // only for string and number literals! Literals match if they convert to
+  // the same string, so they are compared without allocating on the heap.
+  uint32_t Hash();
+  static bool Match(void* literal1, void* literal2);
 
   TypeFeedbackId LiteralFeedbackId() const { return reuse(id()); }
 
  protected:
   Literal(Zone* zone, const AstValue* value, int position, IdGen* id_gen)
       : Expression(zone, position, id_gen),
-        value_(value),
-        isolate_(zone->isolate()) {}
+        value_(value) {}
 
  private:
-  Handle<String> ToString();
-
   const AstValue* value_;
-  // TODO(dcarney): remove.  this is only needed for Match and Hash.
-  Isolate* isolate_;
 };
 
 
@@ -1662,10 +1667,10 @@ class VariableProxy FINAL : public Expression, public FeedbackSlotInterface {
 
   const AstRawString* name_;
   Variable* var_;  // resolved variable, or NULL
-  bool is_this_;
-  bool is_assigned_;
   Interface* interface_;
   int variable_feedback_slot_;
+  bool is_this_ : 1;
+  bool is_assigned_ : 1;
 };
 
 
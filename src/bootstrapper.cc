@@ -2179,6 +2179,8 @@ void Genesis::InstallJSFunctionResultCaches() {
 void Genesis::InitializeNormalizedMapCaches() {
   Handle<NormalizedMapCache> cache = NormalizedMapCache::New(isolate());
   native_context()->set_normalized_map_cache(*cache);
+  native_context()->set_reoptimized_map_cache(
+      *factory()->NewFixedArray(Map::kReoptimizedMapCacheLength, TENURED));
 }
 
 
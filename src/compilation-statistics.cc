@@ -0,0 +1,83 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/compilation-statistics.h"
+#include "src/isolate.h"
+
+namespace v8 {
+namespace internal {
+
+CompilationStatistics::PhaseScope::PhaseScope(Isolate* isolate, Zone* zone,
+                                              Tier tier, const char* phase)
+    : isolate_(isolate), zone_(zone), tier_(tier), phase_(phase),
+      zone_start_(0) {
+  if (FLAG_compile_stats) {
+    if (zone_ != NULL) zone_start_ = zone_->allocation_size();
+    timer_.Start();
+  }
+}
+
+
+CompilationStatistics::PhaseScope::~PhaseScope() {
+  if (FLAG_compile_stats) {
+    size_t zone_bytes =
+        zone_ == NULL ? 0 : zone_->allocation_size() - zone_start_;
+    isolate_->compilation_statistics()->RecordPhase(
+        tier_, phase_, timer_.Elapsed(), zone_bytes);
+  }
+}
+
+
+void CompilationStatistics::RecordPhase(Tier tier, const char* phase,
+                                        base::TimeDelta time,
+                                        size_t zone_bytes) {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  for (int i = 0; i < phases_.length(); ++i) {
+    PhaseStats& stats = phases_[i];
+    if (stats.tier == tier && strcmp(stats.phase, phase) == 0) {
+      stats.count++;
+      stats.time += time;
+      stats.zone_bytes += zone_bytes;
+      return;
+    }
+  }
+  PhaseStats stats = { tier, phase, 1, time, zone_bytes };
+  phases_.Add(stats);
+}
+
+
+int CompilationStatistics::NumberOfPhases() {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  return phases_.length();
+}
+
+
+bool CompilationStatistics::GetPhase(int index, PhaseStats* stats) {
+  base::LockGuard<base::Mutex> lock_guard(&mutex_);
+  if (index < 0 || index >= phases_.length()) return false;
+  *stats = phases_[index];
+  return true;
+}
+
+
+const char* CompilationStatistics::TierName(Tier tier) {
+  switch (tier) {
+    case PARSER:
+      return "parser";
+    case FULL_CODEGEN:
+      return "full-codegen";
+    case CRANKSHAFT:
+      return "crankshaft";
+    case TURBOFAN:
+      return "turbofan";
+    case INSTALLATION:
+      return "installation";
+  }
+  UNREACHABLE();
+  return NULL;
+}
+
+} }  // namespace v8::internal
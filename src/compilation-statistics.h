@@ -0,0 +1,74 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILATION_STATISTICS_H_
+#define V8_COMPILATION_STATISTICS_H_
+
+#include "src/allocation.h"
+#include "src/base/platform/elapsed-timer.h"
+#include "src/base/platform/mutex.h"
+#include "src/list.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Zone;
+
+// Per-isolate time and zone memory spent in each phase of each compiler
+// tier, accumulated over all compilations while --compile-stats is on.
+// Phases may be recorded from the concurrent recompilation thread.
+class CompilationStatistics FINAL : public Malloced {
+ public:
+  enum Tier { PARSER, FULL_CODEGEN, CRANKSHAFT, TURBOFAN, INSTALLATION };
+
+  struct PhaseStats {
+    Tier tier;
+    const char* phase;
+    int count;
+    base::TimeDelta time;
+    size_t zone_bytes;
+  };
+
+  // Records time and zone allocation of a phase for its scope.
+  class PhaseScope FINAL BASE_EMBEDDED {
+   public:
+    PhaseScope(Isolate* isolate, Zone* zone, Tier tier, const char* phase);
+    ~PhaseScope();
+
+   private:
+    Isolate* isolate_;
+    Zone* zone_;
+    Tier tier_;
+    const char* phase_;
+    size_t zone_start_;
+    base::ElapsedTimer timer_;
+
+    DISALLOW_COPY_AND_ASSIGN(PhaseScope);
+  };
+
+  CompilationStatistics() : phases_(16) {}
+
+  // Accumulates one run of {phase}, which must be a static string.
+  void RecordPhase(Tier tier, const char* phase, base::TimeDelta time,
+                   size_t zone_bytes);
+
+  int NumberOfPhases();
+
+  // Copies the statistics of the phase at {index} into {stats}. Returns
+  // false if {index} is out of range.
+  bool GetPhase(int index, PhaseStats* stats);
+
+  static const char* TierName(Tier tier);
+
+ private:
+  base::Mutex mutex_;
+  List<PhaseStats> phases_;
+
+  DISALLOW_COPY_AND_ASSIGN(CompilationStatistics);
+};
+
+} }  // namespace v8::internal
+
+#endif  // V8_COMPILATION_STATISTICS_H_
@@ -403,12 +403,17 @@ OptimizedCompileJob::Status OptimizedCompileJob::CreateGraph() {
       info()->function()->dont_optimize_reason() != kTryFinallyStatement &&
       // TODO(turbofan): Make OSR work and remove this bailout.
       !info()->is_osr()) {
-    compiler::Pipeline pipeline(info());
-    pipeline.GenerateCode();
-    if (!info()->code().is_null()) {
-      if (FLAG_turbo_deoptimization) {
-        info()->context()->native_context()->AddOptimizedCode(*info()->code());
-      }
+    // Graph building and lowering happen here and code assembly in
+    // GenerateCode. Concurrent jobs generate instructions in OptimizeGraph,
+    // others do it right away so that they can still fall back to
+    // Crankshaft if it fails.
+    Timer t(this, &time_taken_to_create_graph_);
+    compiler::Pipeline* pipeline =
+        new (info()->zone()) compiler::Pipeline(info());
+    if (pipeline->CreateGraph() &&
+        (GeneratesInstructionsConcurrently() ||
+         pipeline->GenerateInstructions())) {
+      pipeline_ = pipeline;
       return SetLastStatus(SUCCEEDED);
     }
   }
@@ -420,7 +425,10 @@ OptimizedCompileJob::Status OptimizedCompileJob::CreateGraph() {
     isolate()->GetHTracer()->TraceCompilation(info());
   }
 
-  // Type-check the function.
+  // Type-check the function. This and graph building below stay on the main
+  // thread even for concurrent jobs: both read type feedback, maps and
+  // constants straight from the heap and allocate handles throughout. They
+  // are covered by the V8.RecompileSynchronous histogram.
   AstTyper::Run(info());
 
   graph_builder_ = (FLAG_hydrogen_track_positions || FLAG_trace_ic)
@@ -462,12 +470,18 @@ OptimizedCompileJob::Status OptimizedCompileJob::OptimizeGraph() {
   DisallowCodeDependencyChange no_dependency_change;
 
   DCHECK(last_status() == SUCCEEDED);
-  // TODO(turbofan): Currently everything is done in the first phase.
-  if (!info()->code().is_null()) {
-    return last_status();
+  Timer t(this, &time_taken_to_optimize_);
+  if (pipeline_ != NULL) {
+    if (!GeneratesInstructionsConcurrently() ||
+        pipeline_->GenerateInstructions()) {
+      return SetLastStatus(SUCCEEDED);
+    }
+    // The pipeline has set the bailout reason. Optimization cannot be
+    // disabled from the concurrent recompilation thread,
+    // GetConcurrentlyOptimizedCode does that.
+    return AbortOptimization();
   }
 
-  Timer t(this, &time_taken_to_optimize_);
   DCHECK(graph_ != NULL);
   BailoutReason bailout_reason = kNoReason;
 
@@ -484,10 +498,22 @@ OptimizedCompileJob::Status OptimizedCompileJob::OptimizeGraph() {
 
 OptimizedCompileJob::Status OptimizedCompileJob::GenerateCode() {
   DCHECK(last_status() == SUCCEEDED);
-  // TODO(turbofan): Currently everything is done in the first phase.
-  if (!info()->code().is_null()) {
+  if (pipeline_ != NULL) {
+    {  // Scope for timer.
+      Timer timer(this, &time_taken_to_codegen_);
+      Handle<Code> optimized_code = pipeline_->FinishCode();
+      if (optimized_code.is_null()) {
+        if (info()->bailout_reason() == kNoReason) {
+          info_->set_bailout_reason(kCodeGenerationFailed);
+        }
+        return AbortAndDisableOptimization();
+      }
+    }
     RecordOptimizationStats();
-    return last_status();
+    if (FLAG_turbo_deoptimization) {
+      info()->context()->native_context()->AddOptimizedCode(*info()->code());
+    }
+    return SetLastStatus(SUCCEEDED);
   }
 
   DCHECK(!info()->HasAbortedDueToDependencyChange());
@@ -1173,14 +1199,19 @@ static bool GetOptimizedCodeNow(CompilationInfo* info) {
   if (!CompileOptimizedPrologue(info)) return false;
 
   TimerEventScope<TimerEventRecompileSynchronous> timer(info->isolate());
+  HistogramTimerScope recompile_timer(
+      info->isolate()->counters()->recompile_synchronous());
 
-  OptimizedCompileJob job(info);
+  OptimizedCompileJob job(info, false);
   if (job.CreateGraph() != OptimizedCompileJob::SUCCEEDED) return false;
   if (job.OptimizeGraph() != OptimizedCompileJob::SUCCEEDED) return false;
   if (job.GenerateCode() != OptimizedCompileJob::SUCCEEDED) return false;
 
   // Success!
   DCHECK(!info->isolate()->has_pending_exception());
+  CompilationStatistics::PhaseScope install(
+      info->isolate(), NULL, CompilationStatistics::INSTALLATION,
+      "install optimized code");
   InsertCodeIntoOptimizedCodeMap(info);
   Compiler::RecordFunctionCompilation(
       Logger::LAZY_COMPILE_TAG, info, info->shared_info());
@@ -1191,6 +1222,7 @@ static bool GetOptimizedCodeNow(CompilationInfo* info) {
 static bool GetOptimizedCodeLater(CompilationInfo* info) {
   Isolate* isolate = info->isolate();
   if (!isolate->optimizing_compiler_thread()->IsQueueAvailable()) {
+    isolate->counters()->concurrent_recompilation_dropped()->Increment();
     if (FLAG_trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       info->closure()->PrintName();
@@ -1199,16 +1231,23 @@ static bool GetOptimizedCodeLater(CompilationInfo* info) {
     return false;
   }
 
+  // Hotter functions are compiled first. Read the ticks before building the
+  // graph, which may replace the unoptimized code.
+  int priority = info->shared_info()->code()->profiler_ticks();
+
   CompilationHandleScope handle_scope(info);
   if (!CompileOptimizedPrologue(info)) return false;
   info->SaveHandles();  // Copy handles to the compilation handle scope.
 
   TimerEventScope<TimerEventRecompileSynchronous> timer(info->isolate());
+  HistogramTimerScope recompile_timer(
+      info->isolate()->counters()->recompile_synchronous());
 
-  OptimizedCompileJob* job = new(info->zone()) OptimizedCompileJob(info);
+  OptimizedCompileJob* job =
+      new(info->zone()) OptimizedCompileJob(info, true);
   OptimizedCompileJob::Status status = job->CreateGraph();
   if (status != OptimizedCompileJob::SUCCEEDED) return false;
-  isolate->optimizing_compiler_thread()->QueueForOptimization(job);
+  isolate->optimizing_compiler_thread()->QueueForOptimization(job, priority);
 
   if (FLAG_trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
@@ -1286,6 +1325,8 @@ Handle<Code> Compiler::GetConcurrentlyOptimizedCode(OptimizedCompileJob* job) {
 
   VMState<COMPILER> state(isolate);
   TimerEventScope<TimerEventRecompileSynchronous> timer(info->isolate());
+  HistogramTimerScope recompile_timer(
+      info->isolate()->counters()->recompile_synchronous());
 
   Handle<SharedFunctionInfo> shared = info->shared_info();
   shared->code()->set_profiler_ticks(0);
@@ -1296,6 +1337,15 @@ Handle<Code> Compiler::GetConcurrentlyOptimizedCode(OptimizedCompileJob* job) {
   // 3) The code may have already been invalidated due to dependency change.
   // 4) Debugger may have been activated.
 
+  // TurboFan instruction generation failures on the concurrent
+  // recompilation thread disable optimization here, on the main thread.
+  if (job->last_status() == OptimizedCompileJob::BAILED_OUT &&
+      job->uses_turbofan() &&
+      (info->bailout_reason() == kNotEnoughVirtualRegistersForValues ||
+       info->bailout_reason() == kNotEnoughVirtualRegistersRegalloc)) {
+    shared->DisableOptimization(info->bailout_reason());
+  }
+
   if (job->last_status() != OptimizedCompileJob::SUCCEEDED ||
       shared->optimization_disabled() ||
       info->HasAbortedDueToDependencyChange() ||
@@ -1307,6 +1357,9 @@ Handle<Code> Compiler::GetConcurrentlyOptimizedCode(OptimizedCompileJob* job) {
     return Handle<Code>::null();
   }
 
+  CompilationStatistics::PhaseScope install(
+      isolate, NULL, CompilationStatistics::INSTALLATION,
+      "install optimized code");
   Compiler::RecordFunctionCompilation(
       Logger::LAZY_COMPILE_TAG, info.get(), shared);
   if (info->shared_info()->SearchOptimizedCodeMap(
@@ -1359,9 +1412,10 @@ void Compiler::RecordFunctionCompilation(Logger::LogEventsAndTags tag,
 }
 
 
-CompilationPhase::CompilationPhase(const char* name, CompilationInfo* info)
-    : name_(name), info_(info), zone_(info->isolate()) {
-  if (FLAG_hydrogen_stats) {
+CompilationPhase::CompilationPhase(const char* name, CompilationInfo* info,
+                                   CompilationStatistics::Tier tier)
+    : name_(name), info_(info), tier_(tier), zone_(info->isolate()) {
+  if (FLAG_hydrogen_stats || FLAG_compile_stats) {
     info_zone_start_allocation_size_ = info->zone()->allocation_size();
     timer_.Start();
   }
@@ -1369,10 +1423,17 @@ CompilationPhase::CompilationPhase(const char* name, CompilationInfo* info)
 
 
 CompilationPhase::~CompilationPhase() {
-  if (FLAG_hydrogen_stats) {
+  if (FLAG_hydrogen_stats || FLAG_compile_stats) {
     unsigned size = zone()->allocation_size();
     size += info_->zone()->allocation_size() - info_zone_start_allocation_size_;
-    isolate()->GetHStatistics()->SaveTiming(name_, timer_.Elapsed(), size);
+    base::TimeDelta elapsed = timer_.Elapsed();
+    if (FLAG_hydrogen_stats) {
+      isolate()->GetHStatistics()->SaveTiming(name_, elapsed, size);
+    }
+    if (FLAG_compile_stats) {
+      isolate()->compilation_statistics()->RecordPhase(tier_, name_, elapsed,
+                                                       size);
+    }
   }
 }
 
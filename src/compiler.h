@@ -7,6 +7,7 @@
 
 #include "src/allocation.h"
 #include "src/ast.h"
+#include "src/compilation-statistics.h"
 #include "src/zone.h"
 
 namespace v8 {
@@ -542,20 +543,28 @@ class HGraph;
 class HOptimizedGraphBuilder;
 class LChunk;
 
+namespace compiler {
+class Pipeline;
+}
+
 // A helper class that calls the three compilation phases in
-// Crankshaft and keeps track of its state.  The three phases
+// Crankshaft or TurboFan and keeps track of its state.  The three phases
 // CreateGraph, OptimizeGraph and GenerateAndInstallCode can either
 // fail, bail-out to the full code generator or succeed.  Apart from
 // their return value, the status of the phase last run can be checked
 // using last_status().
 class OptimizedCompileJob: public ZoneObject {
  public:
-  explicit OptimizedCompileJob(CompilationInfo* info)
+  // Concurrent jobs run OptimizeGraph on the concurrent recompilation
+  // thread.
+  OptimizedCompileJob(CompilationInfo* info, bool is_concurrent)
       : info_(info),
         graph_builder_(NULL),
         graph_(NULL),
         chunk_(NULL),
+        pipeline_(NULL),
         last_status_(FAILED),
+        is_concurrent_(is_concurrent),
         awaiting_install_(false) { }
 
   enum Status {
@@ -567,6 +576,7 @@ class OptimizedCompileJob: public ZoneObject {
   MUST_USE_RESULT Status GenerateCode();
 
   Status last_status() const { return last_status_; }
+  bool uses_turbofan() const { return pipeline_ != NULL; }
   CompilationInfo* info() const { return info_; }
   Isolate* isolate() const { return info()->isolate(); }
 
@@ -592,15 +602,22 @@ class OptimizedCompileJob: public ZoneObject {
 
   bool IsWaitingForInstall() { return awaiting_install_; }
 
+  // Time the job spent in the concurrent recompilation queue.
+  base::TimeDelta time_queued() const { return time_queued_; }
+  void set_time_queued(base::TimeDelta time) { time_queued_ = time; }
+
  private:
   CompilationInfo* info_;
   HOptimizedGraphBuilder* graph_builder_;
   HGraph* graph_;
   LChunk* chunk_;
+  compiler::Pipeline* pipeline_;
   base::TimeDelta time_taken_to_create_graph_;
   base::TimeDelta time_taken_to_optimize_;
   base::TimeDelta time_taken_to_codegen_;
+  base::TimeDelta time_queued_;
   Status last_status_;
+  bool is_concurrent_;
   bool awaiting_install_;
 
   MUST_USE_RESULT Status SetLastStatus(Status status) {
@@ -609,6 +626,12 @@ class OptimizedCompileJob: public ZoneObject {
   }
   void RecordOptimizationStats();
 
+  // TurboFan tracing prints heap constants, so traced jobs generate
+  // instructions on the main thread.
+  bool GeneratesInstructionsConcurrently() const {
+    return is_concurrent_ && !FLAG_trace_turbo;
+  }
+
   struct Timer {
     Timer(OptimizedCompileJob* job, base::TimeDelta* location)
         : job_(job), location_(location) {
@@ -695,7 +718,9 @@ class Compiler : public AllStatic {
 
 class CompilationPhase BASE_EMBEDDED {
  public:
-  CompilationPhase(const char* name, CompilationInfo* info);
+  CompilationPhase(const char* name, CompilationInfo* info,
+                   CompilationStatistics::Tier tier =
+                       CompilationStatistics::CRANKSHAFT);
   ~CompilationPhase();
 
  protected:
@@ -709,6 +734,7 @@ class CompilationPhase BASE_EMBEDDED {
  private:
   const char* name_;
   CompilationInfo* info_;
+  CompilationStatistics::Tier tier_;
   Zone zone_;
   unsigned info_zone_start_allocation_size_;
   base::ElapsedTimer timer_;
@@ -177,7 +177,10 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       break;
     }
     case kArchJmp:
-      __ b(code_->GetLabel(i.InputBlock(0)));
+      // Jump threading may have skipped all blocks up to the target.
+      if (!IsNextInAssemblyOrder(i.InputBlock(0))) {
+        __ b(code_->GetLabel(i.InputBlock(0)));
+      }
       DCHECK_EQ(LeaveCC, i.OutputSBit());
       break;
     case kArchNop:
@@ -169,7 +169,10 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       break;
     }
     case kArchJmp:
-      __ B(code_->GetLabel(i.InputBlock(0)));
+      // Jump threading may have skipped all blocks up to the target.
+      if (!IsNextInAssemblyOrder(i.InputBlock(0))) {
+        __ B(code_->GetLabel(i.InputBlock(0)));
+      }
       break;
     case kArchNop:
       // don't emit code for nops.
@@ -41,10 +41,14 @@ Handle<Code> CodeGenerator::GenerateCode() {
   info->set_prologue_offset(masm()->pc_offset());
   AssemblePrologue();
 
-  // Assemble all instructions.
+  // Assemble all instructions, leaving out blocks removed by jump threading.
+  bool skip = false;
   for (InstructionSequence::const_iterator i = code()->begin();
        i != code()->end(); ++i) {
-    AssembleInstruction(*i);
+    if ((*i)->IsBlockStart()) {
+      skip = code()->IsSkipped(BlockStartInstruction::cast(*i)->block());
+    }
+    if (!skip) AssembleInstruction(*i);
   }
 
   EmitLazyDeoptimizationCallTable();
@@ -62,6 +66,8 @@ Handle<Code> CodeGenerator::GenerateCode() {
       masm(), Code::ComputeFlags(kind), info);
   result->set_is_turbofanned(true);
   result->set_stack_slots(frame()->GetSpillSlotCount());
+  isolate()->counters()->turbo_stack_slots()->Increment(
+      frame()->GetSpillSlotCount());
   result->set_safepoint_table_offset(safepoints()->GetCodeOffset());
 
   PopulateDeoptimizationData(result);
@@ -74,6 +80,11 @@ Handle<Code> CodeGenerator::GenerateCode() {
 }
 
 
+bool CodeGenerator::IsNextInAssemblyOrder(BasicBlock* block) const {
+  return code()->IsNextInAssemblyOrder(current_block_, block);
+}
+
+
 Safepoint::Id CodeGenerator::RecordSafepoint(PointerMap* pointers,
                                              Safepoint::Kind kind,
                                              int arguments,
@@ -167,7 +178,26 @@ void CodeGenerator::AssembleGap(GapInstruction* instr) {
     GapInstruction::InnerPosition inner_pos =
         static_cast<GapInstruction::InnerPosition>(i);
     ParallelMove* move = instr->GetParallelMove(inner_pos);
-    if (move != NULL) resolver()->Resolve(move);
+    if (move == NULL) continue;
+    RecordMoveStats(move);
+    resolver()->Resolve(move);
+  }
+}
+
+
+void CodeGenerator::RecordMoveStats(ParallelMove* move) {
+  Counters* counters = isolate()->counters();
+  ZoneList<MoveOperands>* moves = move->move_operands();
+  for (int i = 0; i < moves->length(); ++i) {
+    MoveOperands* operands = &moves->at(i);
+    if (operands->IsRedundant()) continue;
+    counters->turbo_gap_moves()->Increment();
+    InstructionOperand* source = operands->source();
+    InstructionOperand* destination = operands->destination();
+    if (source->IsStackSlot() || source->IsDoubleStackSlot() ||
+        destination->IsStackSlot() || destination->IsDoubleStackSlot()) {
+      counters->turbo_stack_slot_moves()->Increment();
+    }
   }
 }
 
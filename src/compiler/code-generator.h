@@ -40,10 +40,7 @@ class CodeGenerator FINAL : public GapResolver::Assembler {
 
   // Checks if {block} will appear directly after {current_block_} when
   // assembling code, in which case, a fall-through can be used.
-  bool IsNextInAssemblyOrder(const BasicBlock* block) const {
-    return block->rpo_number_ == (current_block_->rpo_number_ + 1) &&
-           block->deferred_ == current_block_->deferred_;
-  }
+  bool IsNextInAssemblyOrder(BasicBlock* block) const;
 
   // Record a safepoint with the given pointer map.
   Safepoint::Id RecordSafepoint(PointerMap* pointers, Safepoint::Kind kind,
@@ -53,6 +50,7 @@ class CodeGenerator FINAL : public GapResolver::Assembler {
   void AssembleInstruction(Instruction* instr);
   void AssembleSourcePosition(SourcePositionInstruction* instr);
   void AssembleGap(GapInstruction* gap);
+  void RecordMoveStats(ParallelMove* move);
 
   // ===========================================================================
   // ============= Architecture-specific code generation methods. ==============
@@ -26,6 +26,7 @@
         'graph-unittest.h',
         'instruction-selector-unittest.cc',
         'instruction-selector-unittest.h',
+        'load-elimination-unittest.cc',
         'machine-operator-reducer-unittest.cc',
         'machine-operator-unittest.cc',
         'simplified-operator-reducer-unittest.cc',
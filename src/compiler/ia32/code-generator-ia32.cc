@@ -148,7 +148,10 @@ void CodeGenerator::AssembleArchInstruction(Instruction* instr) {
       break;
     }
     case kArchJmp:
-      __ jmp(code()->GetLabel(i.InputBlock(0)));
+      // Jump threading may have skipped all blocks up to the target.
+      if (!IsNextInAssemblyOrder(i.InputBlock(0))) {
+        __ jmp(code()->GetLabel(i.InputBlock(0)));
+      }
       break;
     case kArchNop:
       // don't emit code for nops.
@@ -0,0 +1,235 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+
+#include <algorithm>
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class InstructionScheduler::ScheduleGraphNode FINAL : public ZoneObject {
+ public:
+  ScheduleGraphNode(Zone* zone, Instruction* instr, int latency)
+      : instr_(instr),
+        successors_(zone),
+        unscheduled_predecessors_(0),
+        latency_(latency),
+        total_latency_(0),
+        start_cycle_(0) {}
+
+  Instruction* instruction() const { return instr_; }
+  const ZoneVector<ScheduleGraphNode*>& successors() const {
+    return successors_;
+  }
+  int latency() const { return latency_; }
+
+  // The length of the longest latency path from this node to the end of the
+  // block, used as the scheduling priority.
+  int total_latency() const { return total_latency_; }
+  void set_total_latency(int latency) { total_latency_ = latency; }
+
+  // The earliest cycle in which the inputs of this node are available.
+  int start_cycle() const { return start_cycle_; }
+  void set_start_cycle(int cycle) { start_cycle_ = cycle; }
+
+  void AddSuccessor(ScheduleGraphNode* node) {
+    successors_.push_back(node);
+    node->unscheduled_predecessors_++;
+  }
+
+  // Returns true if the last predecessor of this node was scheduled.
+  bool DropUnscheduledPredecessor() {
+    DCHECK_LT(0, unscheduled_predecessors_);
+    return --unscheduled_predecessors_ == 0;
+  }
+  bool HasUnscheduledPredecessor() const {
+    return unscheduled_predecessors_ != 0;
+  }
+
+ private:
+  Instruction* instr_;
+  ZoneVector<ScheduleGraphNode*> successors_;
+  int unscheduled_predecessors_;
+  int latency_;
+  int total_latency_;
+  int start_cycle_;
+};
+
+
+InstructionScheduler::InstructionScheduler(Zone* zone,
+                                           InstructionSequence* sequence)
+    : zone_(zone), sequence_(sequence), definitions_(zone) {}
+
+
+int InstructionScheduler::GetInstructionFlags(const Instruction* instr) const {
+  // Source positions must stay in front of the instruction they describe.
+  if (instr->IsSourcePosition() || instr->IsCall()) return kHasSideEffect;
+  switch (instr->arch_opcode()) {
+    case kArchCallAddress:
+    case kArchCallCodeObject:
+    case kArchCallJSFunction:
+    case kArchDrop:
+    case kArchJmp:
+    case kArchNop:
+    case kArchRet:
+    // The slow path calls a stub.
+    case kArchTruncateDoubleToI:
+      return kHasSideEffect;
+    default:
+      return GetTargetInstructionFlags(instr);
+  }
+}
+
+
+void InstructionScheduler::ScheduleBlock(
+    ZoneVector<Instruction*>* instructions) {
+  if (instructions->empty()) return;
+  if (definitions_.empty()) {
+    definitions_.resize(sequence_->VirtualRegisterCount(), NULL);
+  }
+
+  // Keep the control instruction at the end of the block.
+  Instruction* control = NULL;
+  if (instructions->back()->IsControl()) {
+    control = instructions->back();
+    instructions->pop_back();
+  }
+
+  // Build the dependency graph in program order.
+  ZoneVector<ScheduleGraphNode*> nodes(zone());
+  ZoneVector<ScheduleGraphNode*> pending_loads(zone());
+  ScheduleGraphNode* last_side_effect = NULL;
+  for (ZoneVector<Instruction*>::iterator i = instructions->begin();
+       i != instructions->end(); ++i) {
+    Instruction* instr = *i;
+    int latency = instr->IsSourcePosition() ? 0 : GetInstructionLatency(instr);
+    ScheduleGraphNode* node =
+        new (zone()) ScheduleGraphNode(zone(), instr, latency);
+    for (size_t j = 0; j < instr->InputCount(); ++j) {
+      InstructionOperand* input = instr->InputAt(j);
+      if (!input->IsUnallocated()) continue;
+      int vreg = UnallocatedOperand::cast(input)->virtual_register();
+      ScheduleGraphNode* definition = definitions_[vreg];
+      if (definition != NULL) definition->AddSuccessor(node);
+    }
+    int flags = GetInstructionFlags(instr);
+    if (flags & kHasSideEffect) {
+      if (last_side_effect != NULL) last_side_effect->AddSuccessor(node);
+      for (ZoneVector<ScheduleGraphNode*>::iterator j = pending_loads.begin();
+           j != pending_loads.end(); ++j) {
+        (*j)->AddSuccessor(node);
+      }
+      pending_loads.clear();
+      last_side_effect = node;
+    } else if (flags & kIsLoadOperation) {
+      if (last_side_effect != NULL) last_side_effect->AddSuccessor(node);
+      pending_loads.push_back(node);
+    }
+    for (size_t j = 0; j < instr->OutputCount(); ++j) {
+      InstructionOperand* output = instr->OutputAt(j);
+      if (!output->IsUnallocated()) continue;
+      definitions_[UnallocatedOperand::cast(output)->virtual_register()] = node;
+    }
+    nodes.push_back(node);
+  }
+
+  // Compute the critical path lengths. Successors always come later in
+  // program order.
+  for (ZoneVector<ScheduleGraphNode*>::reverse_iterator i = nodes.rbegin();
+       i != nodes.rend(); ++i) {
+    ScheduleGraphNode* node = *i;
+    int max_successor_latency = 0;
+    const ZoneVector<ScheduleGraphNode*>& successors = node->successors();
+    for (ZoneVector<ScheduleGraphNode*>::const_iterator j = successors.begin();
+         j != successors.end(); ++j) {
+      max_successor_latency =
+          std::max(max_successor_latency, (*j)->total_latency());
+    }
+    node->set_total_latency(node->latency() + max_successor_latency);
+  }
+
+  // List scheduling, issuing one instruction per cycle. Among the nodes whose
+  // inputs are available, pick the one on the longest path to the end of the
+  // block; ties keep program order.
+  ZoneVector<ScheduleGraphNode*> ready(zone());
+  for (ZoneVector<ScheduleGraphNode*>::iterator i = nodes.begin();
+       i != nodes.end(); ++i) {
+    if (!(*i)->HasUnscheduledPredecessor()) ready.push_back(*i);
+  }
+  instructions->clear();
+  int cycle = 0;
+  while (!ready.empty()) {
+    ZoneVector<ScheduleGraphNode*>::iterator candidate = ready.end();
+    for (ZoneVector<ScheduleGraphNode*>::iterator i = ready.begin();
+         i != ready.end(); ++i) {
+      if ((*i)->start_cycle() > cycle) continue;
+      if (candidate == ready.end() ||
+          (*i)->total_latency() > (*candidate)->total_latency()) {
+        candidate = i;
+      }
+    }
+    if (candidate == ready.end()) {
+      // Nothing can start yet; wait for the earliest input.
+      int next_cycle = kMaxInt;
+      for (ZoneVector<ScheduleGraphNode*>::iterator i = ready.begin();
+           i != ready.end(); ++i) {
+        next_cycle = std::min(next_cycle, (*i)->start_cycle());
+      }
+      cycle = next_cycle;
+      continue;
+    }
+    ScheduleGraphNode* node = *candidate;
+    ready.erase(candidate);
+    instructions->push_back(node->instruction());
+    const ZoneVector<ScheduleGraphNode*>& successors = node->successors();
+    for (ZoneVector<ScheduleGraphNode*>::const_iterator i = successors.begin();
+         i != successors.end(); ++i) {
+      ScheduleGraphNode* successor = *i;
+      successor->set_start_cycle(
+          std::max(successor->start_cycle(), cycle + node->latency()));
+      if (successor->DropUnscheduledPredecessor()) ready.push_back(successor);
+    }
+    cycle++;
+  }
+  DCHECK(nodes.size() == instructions->size());
+  if (control != NULL) instructions->push_back(control);
+
+  // Forget the definitions of this block.
+  for (ZoneVector<ScheduleGraphNode*>::iterator i = nodes.begin();
+       i != nodes.end(); ++i) {
+    Instruction* instr = (*i)->instruction();
+    for (size_t j = 0; j < instr->OutputCount(); ++j) {
+      InstructionOperand* output = instr->OutputAt(j);
+      if (!output->IsUnallocated()) continue;
+      definitions_[UnallocatedOperand::cast(output)->virtual_register()] = NULL;
+    }
+  }
+}
+
+
+#if !V8_TARGET_ARCH_X64 && !V8_TARGET_ARCH_ARM64
+
+bool InstructionScheduler::SchedulerSupported() { return false; }
+
+
+int InstructionScheduler::GetTargetInstructionFlags(
+    const Instruction* instr) const {
+  UNIMPLEMENTED();
+  return kNoOpcodeFlags;
+}
+
+
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
+  UNIMPLEMENTED();
+  return 0;
+}
+
+#endif  // !V8_TARGET_ARCH_X64 && !V8_TARGET_ARCH_ARM64
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,62 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_INSTRUCTION_SCHEDULER_H_
+#define V8_COMPILER_INSTRUCTION_SCHEDULER_H_
+
+#include "src/compiler/instruction.h"
+#include "src/zone-containers.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Reorders the instructions of a basic block before register allocation, so
+// that long latency operations like loads, multiplications and floating
+// point arithmetic start as early as their inputs allow. Dependencies come
+// from virtual register definitions and uses. Loads are not moved across
+// instructions with side effects, and those keep their original order. The
+// control instruction of the block always stays last.
+class InstructionScheduler FINAL {
+ public:
+  InstructionScheduler(Zone* zone, InstructionSequence* sequence);
+
+  // Reorders {instructions}, which are the instructions of a single block in
+  // program order.
+  void ScheduleBlock(ZoneVector<Instruction*>* instructions);
+
+  static bool SchedulerSupported();
+
+ private:
+  enum ArchOpcodeFlags {
+    kNoOpcodeFlags = 0,
+    kIsLoadOperation = 1,  // The instruction reads memory.
+    kHasSideEffect = 2     // The instruction writes memory or has effects
+                           // that must stay in order.
+  };
+
+  class ScheduleGraphNode;
+
+  int GetInstructionFlags(const Instruction* instr) const;
+
+  // Target specific, see instruction-scheduler-<arch>.cc.
+  int GetTargetInstructionFlags(const Instruction* instr) const;
+  int GetInstructionLatency(const Instruction* instr) const;
+
+  Zone* zone() const { return zone_; }
+
+  Zone* zone_;
+  InstructionSequence* sequence_;
+  // The node of the current block that defines each virtual register, or
+  // NULL if it is defined in another block.
+  ZoneVector<ScheduleGraphNode*> definitions_;
+
+  DISALLOW_COPY_AND_ASSIGN(InstructionScheduler);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_INSTRUCTION_SCHEDULER_H_
@@ -4,6 +4,7 @@
 
 #include "src/compiler/instruction-selector.h"
 
+#include "src/compiler/instruction-scheduler.h"
 #include "src/compiler/instruction-selector-impl.h"
 #include "src/compiler/node-matchers.h"
 #include "src/compiler/node-properties-inl.h"
@@ -53,13 +54,27 @@ void InstructionSelector::SelectInstructions() {
   }
 
   // Schedule the selected instructions.
+  bool reorder = FLAG_turbo_instruction_scheduling &&
+                 InstructionScheduler::SchedulerSupported();
+  InstructionScheduler scheduler(zone(), sequence());
+  ZoneVector<Instruction*> block_instructions(zone());
   for (BasicBlockVectorIter i = blocks->begin(); i != blocks->end(); ++i) {
     BasicBlock* block = *i;
     size_t end = block->code_end_;
     size_t start = block->code_start_;
     sequence()->StartBlock(block);
-    while (start-- > end) {
-      sequence()->AddInstruction(instructions_[start], block);
+    if (reorder) {
+      block_instructions.clear();
+      while (start-- > end) block_instructions.push_back(instructions_[start]);
+      scheduler.ScheduleBlock(&block_instructions);
+      for (ZoneVector<Instruction*>::iterator j = block_instructions.begin();
+           j != block_instructions.end(); ++j) {
+        sequence()->AddInstruction(*j, block);
+      }
+    } else {
+      while (start-- > end) {
+        sequence()->AddInstruction(instructions_[start], block);
+      }
     }
     sequence()->EndBlock(block);
   }
@@ -313,7 +313,7 @@ OStream& operator<<(OStream& os, const Constant& constant) {
 
 
 Label* InstructionSequence::GetLabel(BasicBlock* block) {
-  return GetBlockStart(block)->label();
+  return GetBlockStart(GetForwardedBlock(block))->label();
 }
 
 
@@ -322,6 +322,41 @@ BlockStartInstruction* InstructionSequence::GetBlockStart(BasicBlock* block) {
 }
 
 
+void InstructionSequence::ForwardBlock(BasicBlock* block, BasicBlock* target,
+                                       bool skip) {
+  if (forwarding_.empty()) {
+    forwarding_.resize(BasicBlockCount(), NULL);
+    skipped_.resize(BasicBlockCount(), false);
+  }
+  forwarding_[block->rpo_number_] = target;
+  skipped_[block->rpo_number_] = skip;
+}
+
+
+BasicBlock* InstructionSequence::GetForwardedBlock(BasicBlock* block) const {
+  if (forwarding_.empty()) return block;
+  BasicBlock* target = forwarding_[block->rpo_number_];
+  return target == NULL ? block : target;
+}
+
+
+bool InstructionSequence::IsSkipped(BasicBlock* block) const {
+  return !skipped_.empty() && skipped_[block->rpo_number_];
+}
+
+
+bool InstructionSequence::IsNextInAssemblyOrder(BasicBlock* current,
+                                                BasicBlock* block) const {
+  BasicBlock* target = GetForwardedBlock(block);
+  for (int i = current->rpo_number_ + 1; i < BasicBlockCount(); ++i) {
+    BasicBlock* next = BlockAt(i);
+    if (IsSkipped(next)) continue;
+    return next == target && next->deferred_ == current->deferred_;
+  }
+  return false;
+}
+
+
 void InstructionSequence::StartBlock(BasicBlock* block) {
   block->code_start_ = static_cast<int>(instructions_.size());
   BlockStartInstruction* block_start =
@@ -766,7 +766,7 @@ typedef ZoneVector<FrameStateDescriptor*> DeoptimizationVector;
 // Represents architecture-specific generated code before, during, and after
 // register allocation.
 // TODO(titzer): s/IsDouble/IsFloat64/
-class InstructionSequence FINAL {
+class InstructionSequence FINAL : public ZoneObject {
  public:
   InstructionSequence(Linkage* linkage, Graph* graph, Schedule* schedule)
       : graph_(graph),
@@ -781,7 +781,9 @@ class InstructionSequence FINAL {
         doubles_(std::less<int>(), VirtualRegisterSet::allocator_type(zone())),
         references_(std::less<int>(),
                     VirtualRegisterSet::allocator_type(zone())),
-        deoptimization_entries_(zone()) {}
+        deoptimization_entries_(zone()),
+        forwarding_(zone()),
+        skipped_(zone()) {}
 
   int NextVirtualRegister() { return next_virtual_register_++; }
   int VirtualRegisterCount() const { return next_virtual_register_; }
@@ -817,6 +819,16 @@ class InstructionSequence FINAL {
   Label* GetLabel(BasicBlock* block);
   BlockStartInstruction* GetBlockStart(BasicBlock* block);
 
+  // Jump threading. References to a forwarded block resolve to the block it
+  // was forwarded to, and the code of a skipped block is not assembled.
+  void ForwardBlock(BasicBlock* block, BasicBlock* target, bool skip);
+  BasicBlock* GetForwardedBlock(BasicBlock* block) const;
+  bool IsSkipped(BasicBlock* block) const;
+
+  // Checks if {block}, after forwarding, is the first block assembled after
+  // {current}, in which case control can fall through to it.
+  bool IsNextInAssemblyOrder(BasicBlock* current, BasicBlock* block) const;
+
   typedef InstructionDeque::const_iterator const_iterator;
   const_iterator begin() const { return instructions_.begin(); }
   const_iterator end() const { return instructions_.end(); }
@@ -900,6 +912,8 @@ class InstructionSequence FINAL {
   VirtualRegisterSet references_;
   Frame frame_;
   DeoptimizationVector deoptimization_entries_;
+  BasicBlockVector forwarding_;  // Indexed by RPO number, empty if unused.
+  BoolVector skipped_;
 };
 
 OStream& operator<<(OStream& os, const InstructionSequence& code);
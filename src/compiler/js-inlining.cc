@@ -2,6 +2,8 @@
 // Use of this source code is governed by a BSD-style license that can be
 // found in the LICENSE file.
 
+#include <algorithm>
+
 #include "src/compiler/ast-graph-builder.h"
 #include "src/compiler/common-operator.h"
 #include "src/compiler/generic-node-inl.h"
@@ -25,12 +27,12 @@ namespace compiler {
 
 class InlinerVisitor : public NullNodeVisitor {
  public:
-  explicit InlinerVisitor(JSInliner* inliner) : inliner_(inliner) {}
+  explicit InlinerVisitor(NodeVector* calls) : calls_(calls) {}
 
   GenericGraphVisit::Control Post(Node* node) {
     switch (node->opcode()) {
       case IrOpcode::kJSCallFunction:
-        inliner_->TryInlineCall(node);
+        calls_->push_back(node);
         break;
       default:
         break;
@@ -39,13 +41,69 @@ class InlinerVisitor : public NullNodeVisitor {
   }
 
  private:
-  JSInliner* inliner_;
+  NodeVector* calls_;
 };
 
 
+// Source size of the known target of {call}, or kMaxInt if the target is
+// not a constant.
+static int TargetSourceSize(Node* call) {
+  ValueMatcher<Handle<JSFunction> > match(call->InputAt(0));
+  if (!match.HasValue()) return kMaxInt;
+  return match.Value()->shared()->SourceSize();
+}
+
+
+static bool CompareTargetSourceSize(Node* a, Node* b) {
+  return TargetSourceSize(a) < TargetSourceSize(b);
+}
+
+
 void JSInliner::Inline() {
-  InlinerVisitor visitor(this);
+  NodeVector calls(jsgraph_->zone());
+  InlinerVisitor visitor(&calls);
   jsgraph_->graph()->VisitNodeInputsFromEnd(&visitor);
+
+  // Consider small targets first, so that the cumulative budget is spent on
+  // as many call sites as possible.
+  std::stable_sort(calls.begin(), calls.end(), CompareTargetSourceSize);
+  for (NodeVector::iterator i = calls.begin(); i != calls.end(); ++i) {
+    TryInlineCall(*i);
+  }
+}
+
+
+void JSInliner::TraceInline(Handle<JSFunction> function, const char* reason) {
+  if (FLAG_trace_turbo_inlining) {
+    SmartArrayPointer<char> name = function->shared()->DebugName()->ToCString();
+    SmartArrayPointer<char> caller =
+        info_->shared_info()->DebugName()->ToCString();
+    if (reason == NULL) {
+      PrintF("Inlining %s into %s\n", name.get(), caller.get());
+    } else {
+      PrintF("Not Inlining %s into %s because %s\n", name.get(), caller.get(),
+             reason);
+    }
+  }
+}
+
+
+const char* JSInliner::CheckCandidate(Handle<JSFunction> function) {
+  Handle<SharedFunctionInfo> shared(function->shared());
+  if (shared->native()) return "inlinee is native";
+  if (shared->IsApiFunction()) return "inlinee is api function";
+  // Do a quick check on source code length to avoid parsing large
+  // inlining candidates.
+  if (shared->SourceSize() > FLAG_max_inlined_source_size) {
+    return "inlinee text too big";
+  }
+  if (!shared->IsInlineable()) return "inlinee not inlineable";
+  if (*function == *info_->closure()) return "inlinee is recursive";
+  if (inlined_nodes_ + shared->ast_node_count() >
+      FLAG_max_inlined_nodes_cumulative) {
+    return "cumulative AST node limit reached";
+  }
+  return NULL;
 }
 
 
@@ -243,14 +301,9 @@ void JSInliner::TryInlineCall(Node* node) {
   }
 
   Handle<JSFunction> function = match.Value();
-
-  if (function->shared()->native()) {
-    if (FLAG_trace_turbo_inlining) {
-      SmartArrayPointer<char> name =
-          function->shared()->DebugName()->ToCString();
-      PrintF("Not Inlining %s into %s because inlinee is native\n", name.get(),
-             info_->shared_info()->DebugName()->ToCString().get());
-    }
+  const char* reason = CheckCandidate(function);
+  if (reason != NULL) {
+    TraceInline(function, reason);
     return;
   }
 
@@ -259,21 +312,29 @@ void JSInliner::TryInlineCall(Node* node) {
 
   if (info.scope()->arguments() != NULL) {
     // For now do not inline functions that use their arguments array.
-    SmartArrayPointer<char> name = function->shared()->DebugName()->ToCString();
-    if (FLAG_trace_turbo_inlining) {
-      PrintF(
-          "Not Inlining %s into %s because inlinee uses arguments "
-          "array\n",
-          name.get(), info_->shared_info()->DebugName()->ToCString().get());
-    }
+    TraceInline(function, "inlinee uses arguments array");
     return;
   }
 
-  if (FLAG_trace_turbo_inlining) {
-    SmartArrayPointer<char> name = function->shared()->DebugName()->ToCString();
-    PrintF("Inlining %s into %s\n", name.get(),
-           info_->shared_info()->DebugName()->ToCString().get());
+  if (info.function()->dont_optimize_reason() == kTryCatchStatement ||
+      info.function()->dont_optimize_reason() == kTryFinallyStatement) {
+    TraceInline(function, "inlinee contains try statement");
+    return;
+  }
+
+  // Only now the exact AST size of a target that never ran is known.
+  int nodes_added = info.function()->ast_node_count();
+  if (nodes_added > FLAG_max_inlined_nodes) {
+    TraceInline(function, "inlinee AST is too large");
+    return;
+  }
+  if (inlined_nodes_ + nodes_added > FLAG_max_inlined_nodes_cumulative) {
+    TraceInline(function, "cumulative AST node limit reached");
+    return;
   }
+  inlined_nodes_ += nodes_added;
+
+  TraceInline(function, NULL);
 
   Graph graph(info_->zone());
   graph.SetNextNodeId(jsgraph_->graph()->NextNodeID());
@@ -15,15 +15,24 @@ namespace compiler {
 class JSInliner {
  public:
   JSInliner(CompilationInfo* info, JSGraph* jsgraph)
-      : info_(info), jsgraph_(jsgraph) {}
+      : info_(info), jsgraph_(jsgraph), inlined_nodes_(0) {}
 
+  // Inline the call sites with known targets, smallest targets first, until
+  // the cumulative node budget is used up.
   void Inline();
   void TryInlineCall(Node* node);
 
  private:
-  friend class InlinerVisitor;
   CompilationInfo* info_;
   JSGraph* jsgraph_;
+  // Number of AST nodes inlined so far, checked against
+  // --max-inlined-nodes-cumulative like in Crankshaft.
+  int inlined_nodes_;
+
+  // Returns the reason why {function} must not be inlined before it is
+  // parsed, or NULL if it is a candidate.
+  const char* CheckCandidate(Handle<JSFunction> function);
+  void TraceInline(Handle<JSFunction> function, const char* reason);
 
   static void UnifyReturn(Graph* graph);
 };
@@ -0,0 +1,81 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/jump-threading.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+BasicBlock* JumpThreading::GetGotoTarget(InstructionSequence* code,
+                                         BasicBlock* block) {
+  if (block->control_ != BasicBlock::kGoto) return NULL;
+  for (int i = block->first_instruction_index();
+       i <= block->last_instruction_index(); ++i) {
+    Instruction* instr = code->InstructionAt(i);
+    if (instr->IsGapMoves()) {
+      GapInstruction* gap = GapInstruction::cast(instr);
+      for (int j = GapInstruction::FIRST_INNER_POSITION;
+           j <= GapInstruction::LAST_INNER_POSITION; ++j) {
+        ParallelMove* move = gap->GetParallelMove(
+            static_cast<GapInstruction::InnerPosition>(j));
+        if (move != NULL && !move->IsRedundant()) return NULL;
+      }
+    } else if (!instr->IsSourcePosition()) {
+      ArchOpcode opcode = ArchOpcodeField::decode(instr->opcode());
+      if (opcode != kArchJmp && opcode != kArchNop) return NULL;
+    }
+  }
+  return block->SuccessorAt(0);
+}
+
+
+bool JumpThreading::CanFallThrough(InstructionSequence* code,
+                                   BasicBlock* block) {
+  Instruction* last = code->InstructionAt(block->last_instruction_index());
+  if (!last->IsControl()) return true;
+  if (FlagsModeField::decode(last->opcode()) == kFlags_branch) {
+    // Branches only fall through to their false target if it is the next
+    // block in assembly order, which takes the forwarding into account.
+    return false;
+  }
+  ArchOpcode opcode = ArchOpcodeField::decode(last->opcode());
+  return opcode != kArchJmp && opcode != kArchRet;
+}
+
+
+bool JumpThreading::ApplyForwarding(InstructionSequence* code) {
+  int const block_count = code->BasicBlockCount();
+  bool forwarded = false;
+  bool fall_through = true;  // The prologue falls through to the first block.
+  for (int i = 0; i < block_count; ++i) {
+    BasicBlock* const block = code->BlockAt(i);
+    // Follow chains of empty blocks, giving up on cycles.
+    BasicBlock* target = block;
+    for (int steps = 0; steps < block_count; ++steps) {
+      BasicBlock* next = GetGotoTarget(code, target);
+      if (next == NULL) break;
+      target = next;
+      if (target == block) break;
+    }
+    if (target != block && GetGotoTarget(code, target) == NULL) {
+      // A block that the previous block falls into must still be assembled,
+      // but jumps to it can go to the target directly.
+      bool skip = !fall_through;
+      code->ForwardBlock(block, target, skip);
+      forwarded = true;
+      if (FLAG_trace_turbo) {
+        PrintF("Forwarding B%d to B%d%s\n", block->id(), target->id(),
+               skip ? " (skipped)" : "");
+      }
+      if (skip) continue;
+    }
+    fall_through = CanFallThrough(code, block);
+  }
+  return forwarded;
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,38 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_JUMP_THREADING_H_
+#define V8_COMPILER_JUMP_THREADING_H_
+
+#include "src/compiler/instruction.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Threads jumps through empty blocks after register allocation. A block that
+// contains nothing but redundant gap moves and a goto is forwarded to the
+// final target of that goto, so that jumps and branches to it go directly to
+// the target. Forwarded blocks that cannot be reached by falling through are
+// not assembled at all.
+class JumpThreading : public AllStatic {
+ public:
+  // Records the forwarding in {code}. Returns true if any block was
+  // forwarded.
+  static bool ApplyForwarding(InstructionSequence* code);
+
+ private:
+  // Returns the successor of {block} if it is an empty goto block, or NULL.
+  static BasicBlock* GetGotoTarget(InstructionSequence* code,
+                                   BasicBlock* block);
+
+  // Returns true if the code of {block} may continue into the next block.
+  static bool CanFallThrough(InstructionSequence* code, BasicBlock* block);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_JUMP_THREADING_H_
@@ -0,0 +1,234 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/access-builder.h"
+#include "src/compiler/graph-unittest.h"
+#include "src/compiler/load-elimination.h"
+#include "src/compiler/node-properties-inl.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+class LoadEliminationTest : public GraphTest {
+ public:
+  LoadEliminationTest() : GraphTest(3), simplified_(zone()), machine_(zone()) {}
+  virtual ~LoadEliminationTest() {}
+
+ protected:
+  Reduction Reduce(Node* node) {
+    LoadElimination reducer(zone());
+    return reducer.Reduce(node);
+  }
+
+  Node* LoadField(const FieldAccess& access, Node* object, Node* effect) {
+    return graph()->NewNode(simplified()->LoadField(access), object, effect);
+  }
+  Node* StoreField(const FieldAccess& access, Node* object, Node* value,
+                   Node* effect) {
+    return graph()->NewNode(simplified()->StoreField(access), object, value,
+                            effect, graph()->start());
+  }
+  Node* LoadElement(Node* object, Node* index, Node* effect) {
+    return graph()->NewNode(
+        simplified()->LoadElement(AccessBuilder::ForFixedArrayElement()),
+        object, index, effect);
+  }
+  Node* StoreElement(Node* object, Node* index, Node* value, Node* effect) {
+    return graph()->NewNode(
+        simplified()->StoreElement(AccessBuilder::ForFixedArrayElement()),
+        object, index, value, effect, graph()->start());
+  }
+
+  SimplifiedOperatorBuilder* simplified() { return &simplified_; }
+  MachineOperatorBuilder* machine() { return &machine_; }
+
+ private:
+  SimplifiedOperatorBuilder simplified_;
+  MachineOperatorBuilder machine_;
+};
+
+
+TEST_F(LoadEliminationTest, LoadFieldWithLoadField) {
+  Node* const object = Parameter(0);
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* const load1 = LoadField(access, object, graph()->start());
+  Node* const load2 = LoadField(access, object, load1);
+  Reduction r = Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldWithStoreField) {
+  Node* const object = Parameter(0);
+  Node* const value = Parameter(1);
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* const store = StoreField(access, object, value, graph()->start());
+  Node* const load = LoadField(access, object, store);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(value, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldSkipsStoreToOtherField) {
+  Node* const object = Parameter(0);
+  Node* const value = Parameter(1);
+  Node* const load1 =
+      LoadField(AccessBuilder::ForJSObjectProperties(), object,
+                graph()->start());
+  Node* const store =
+      StoreField(AccessBuilder::ForJSObjectElements(), object, value, load1);
+  Node* const load2 =
+      LoadField(AccessBuilder::ForJSObjectProperties(), object, store);
+  Reduction r = Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldSkipsStoreToDistinctConstant) {
+  Node* const object = FalseConstant();
+  Node* const other = TrueConstant();
+  Node* const value = Parameter(1);
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* const load1 = LoadField(access, object, graph()->start());
+  Node* const store = StoreField(access, other, value, load1);
+  Node* const load2 = LoadField(access, object, store);
+  Reduction r = Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldStopsAtStoreToMayAliasObject) {
+  Node* const object = Parameter(0);
+  Node* const other = Parameter(1);
+  Node* const value = Parameter(2);
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* const load1 = LoadField(access, object, graph()->start());
+  Node* const store = StoreField(access, other, value, load1);
+  Node* const load2 = LoadField(access, object, store);
+  Reduction r = Reduce(load2);
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldAcrossLoopWithLoadField) {
+  Node* const object = Parameter(0);
+  Node* const value = Parameter(1);
+  Node* const load1 =
+      LoadField(AccessBuilder::ForJSObjectProperties(), object,
+                graph()->start());
+  Node* const loop = graph()->NewNode(common()->Loop(2), graph()->start(),
+                                      graph()->start());
+  Node* const effect_phi =
+      graph()->NewNode(common()->EffectPhi(2), load1, load1, loop);
+  Node* const load2 =
+      LoadField(AccessBuilder::ForJSObjectProperties(), object, effect_phi);
+  Node* const store =
+      StoreField(AccessBuilder::ForJSObjectElements(), object, value, load2);
+  effect_phi->ReplaceInput(1, store);
+  Reduction r = Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldHoistedOutOfLoop) {
+  Node* const object = Parameter(0);
+  Node* const value = Parameter(1);
+  Node* const loop = graph()->NewNode(common()->Loop(2), graph()->start(),
+                                      graph()->start());
+  Node* const effect_phi = graph()->NewNode(
+      common()->EffectPhi(2), graph()->start(), graph()->start(), loop);
+  Node* const load =
+      LoadField(AccessBuilder::ForJSObjectProperties(), object, effect_phi);
+  Node* const store =
+      StoreField(AccessBuilder::ForJSObjectElements(), object, value, load);
+  effect_phi->ReplaceInput(1, store);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load, r.replacement());
+  EXPECT_EQ(graph()->start(), NodeProperties::GetEffectInput(load));
+  EXPECT_EQ(effect_phi, NodeProperties::GetEffectInput(store));
+}
+
+
+TEST_F(LoadEliminationTest, LoadFieldNotHoistedOutOfWritingLoop) {
+  Node* const object = Parameter(0);
+  Node* const other = Parameter(1);
+  Node* const value = Parameter(2);
+  FieldAccess const access = AccessBuilder::ForJSObjectProperties();
+  Node* const loop = graph()->NewNode(common()->Loop(2), graph()->start(),
+                                      graph()->start());
+  Node* const effect_phi = graph()->NewNode(
+      common()->EffectPhi(2), graph()->start(), graph()->start(), loop);
+  Node* const load = LoadField(access, object, effect_phi);
+  Node* const store = StoreField(access, other, value, load);
+  effect_phi->ReplaceInput(1, store);
+  Reduction r = Reduce(load);
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(LoadEliminationTest, LoadElementWithStoreElement) {
+  Node* const object = Parameter(0);
+  Node* const index = Parameter(1);
+  Node* const value = Parameter(2);
+  Node* const store = StoreElement(object, index, value, graph()->start());
+  Node* const load = LoadElement(object, index, store);
+  Reduction r = Reduce(load);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(value, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadElementStopsAtStoreToOtherIndex) {
+  Node* const object = Parameter(0);
+  Node* const index = Parameter(1);
+  Node* const value = Parameter(2);
+  Node* const load1 = LoadElement(object, index, graph()->start());
+  Node* const store = StoreElement(object, Int32Constant(0), value, load1);
+  Node* const load2 = LoadElement(object, index, store);
+  Reduction r = Reduce(load2);
+  ASSERT_FALSE(r.Changed());
+}
+
+
+TEST_F(LoadEliminationTest, LoadWithStoreToDisjointOffset) {
+  Node* const base = Parameter(0);
+  Node* const value = Parameter(1);
+  Node* const index = Int32Constant(8);
+  Node* const load1 = graph()->NewNode(machine()->Load(kMachInt32), base,
+                                       index, graph()->start());
+  Node* const store =
+      graph()->NewNode(machine()->Store(kMachInt32, kNoWriteBarrier), base,
+                       Int32Constant(12), value, load1, graph()->start());
+  Node* const load2 =
+      graph()->NewNode(machine()->Load(kMachInt32), base, index, store);
+  Reduction r = Reduce(load2);
+  ASSERT_TRUE(r.Changed());
+  EXPECT_EQ(load1, r.replacement());
+}
+
+
+TEST_F(LoadEliminationTest, LoadDoesNotForwardTruncatingStore) {
+  Node* const base = Parameter(0);
+  Node* const value = Parameter(1);
+  Node* const index = Int32Constant(8);
+  Node* const store =
+      graph()->NewNode(machine()->Store(kMachInt8, kNoWriteBarrier), base,
+                       index, value, graph()->start(), graph()->start());
+  Node* const load =
+      graph()->NewNode(machine()->Load(kMachInt8), base, index, store);
+  Reduction r = Reduce(load);
+  ASSERT_FALSE(r.Changed());
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,330 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/load-elimination.h"
+
+#include "src/compiler/generic-node-inl.h"
+#include "src/compiler/node-matchers.h"
+#include "src/compiler/node-properties-inl.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+namespace {
+
+// Returns true if {a} and {b} may refer to the same object. Only distinct
+// heap constants are known to be different objects.
+bool MayAlias(Node* a, Node* b) {
+  if (a == b) return true;
+  if (a->opcode() == IrOpcode::kHeapConstant &&
+      b->opcode() == IrOpcode::kHeapConstant) {
+    return OpParameter<Unique<Object> >(a) == OpParameter<Unique<Object> >(b);
+  }
+  return true;
+}
+
+
+// Returns true if the byte ranges [offset, offset + size) of both accesses
+// overlap.
+bool Overlaps(int offset_a, MachineType type_a, int offset_b,
+              MachineType type_b) {
+  return offset_a < offset_b + ElementSizeOf(type_b) &&
+         offset_b < offset_a + ElementSizeOf(type_a);
+}
+
+
+// Returns true if a value written with {type} reads back unchanged, i.e. the
+// store neither truncates nor converts it.
+bool CanForwardStoredValue(MachineType type) {
+  switch (RepresentationOf(type)) {
+    case kRepWord32:
+    case kRepWord64:
+    case kRepFloat64:
+    case kRepTagged:
+      return true;
+    default:
+      return false;
+  }
+}
+
+
+// Returns true if the walk up the effect chain may step over {effect}, which
+// neither writes memory nor merges several effect chains.
+bool CanSkip(Node* effect) {
+  return effect->op()->HasProperty(Operator::kNoWrite) &&
+         OperatorProperties::GetEffectInputCount(effect->op()) == 1;
+}
+
+
+// Returns true if {effect} may write to the field described by {access} of
+// {object}. Merges of effect chains are conservatively treated as writes.
+bool MayWriteField(Node* effect, Node* object, const FieldAccess& access) {
+  switch (effect->opcode()) {
+    case IrOpcode::kStoreField: {
+      FieldAccess const other = FieldAccessOf(effect->op());
+      Node* const other_object = NodeProperties::GetValueInput(effect, 0);
+      bool overlaps = Overlaps(access.offset, access.machine_type,
+                               other.offset, other.machine_type);
+      if (access.base_is_tagged == kTaggedBase &&
+          other.base_is_tagged == kTaggedBase) {
+        // Fields of distinct tagged objects never overlap.
+        return overlaps && MayAlias(object, other_object);
+      }
+      return object != other_object || overlaps;
+    }
+    case IrOpcode::kStoreElement: {
+      // Element stores only write to the elements of their own object.
+      // Stores through an untagged base never write tagged fields: the only
+      // untagged element accesses in this tree are external array and raw
+      // backing store accesses, which write untagged values outside of the
+      // heap.
+      ElementAccess const other = ElementAccessOf(effect->op());
+      if (access.base_is_tagged != kTaggedBase) return true;
+      if (other.base_is_tagged != kTaggedBase) {
+        DCHECK_NE(kRepTagged, RepresentationOf(other.machine_type));
+        return false;
+      }
+      return MayAlias(object, NodeProperties::GetValueInput(effect, 0));
+    }
+    default:
+      return !CanSkip(effect);
+  }
+}
+
+
+bool IsSameFieldAccess(const FieldAccess& lhs, const FieldAccess& rhs) {
+  return StaticParameterTraits<FieldAccess>::Equals(lhs, rhs);
+}
+
+
+bool IsSameElementAccess(const ElementAccess& lhs, const ElementAccess& rhs) {
+  return StaticParameterTraits<ElementAccess>::Equals(lhs, rhs);
+}
+
+}  // namespace
+
+
+LoadElimination::~LoadElimination() {}
+
+
+Reduction LoadElimination::Reduce(Node* node) {
+  switch (node->opcode()) {
+    case IrOpcode::kLoadField:
+      return ReduceLoadField(node);
+    case IrOpcode::kLoadElement:
+      return ReduceLoadElement(node);
+    case IrOpcode::kLoad:
+      return ReduceLoad(node);
+    default:
+      break;
+  }
+  return NoChange();
+}
+
+
+Reduction LoadElimination::ReduceLoadField(Node* node) {
+  DCHECK_EQ(IrOpcode::kLoadField, node->opcode());
+  FieldAccess const access = FieldAccessOf(node->op());
+  Node* const object = NodeProperties::GetValueInput(node, 0);
+  bool hoist = false;
+  Node* effect = NodeProperties::GetEffectInput(node);
+  for (;; effect = NodeProperties::GetEffectInput(effect)) {
+    switch (effect->opcode()) {
+      case IrOpcode::kLoadField: {
+        if (object == NodeProperties::GetValueInput(effect, 0) &&
+            IsSameFieldAccess(access, FieldAccessOf(effect->op()))) {
+          NodeProperties::ReplaceWithValue(node, effect);
+          return Replace(effect);
+        }
+        break;
+      }
+      case IrOpcode::kStoreField: {
+        if (object == NodeProperties::GetValueInput(effect, 0) &&
+            IsSameFieldAccess(access, FieldAccessOf(effect->op())) &&
+            CanForwardStoredValue(access.machine_type)) {
+          Node* const value = NodeProperties::GetValueInput(effect, 1);
+          NodeProperties::ReplaceWithValue(node, value);
+          return Replace(value);
+        }
+        break;
+      }
+      case IrOpcode::kEffectPhi: {
+        // Continue in front of a loop that leaves the field untouched.
+        if (FLAG_turbo_load_hoisting &&
+            !LoopMayWriteField(effect, object, access)) {
+          hoist = true;
+          continue;
+        }
+        break;
+      }
+      default:
+        break;
+    }
+    if (MayWriteField(effect, object, access)) break;
+  }
+  if (!hoist) return NoChange();
+
+  // The field has the same value at {effect} as at {node}. Unlink {node} from
+  // the effect chain and make it depend on {effect} directly, so that the
+  // scheduler is free to move it out of the loops in between.
+  for (UseIter i = node->uses().begin(); i != node->uses().end();) {
+    if (NodeProperties::IsEffectEdge(i.edge())) {
+      i = i.UpdateToAndIncrement(NodeProperties::GetEffectInput(node));
+    } else {
+      ++i;
+    }
+  }
+  NodeProperties::ReplaceEffectInput(node, effect);
+  return Changed(node);
+}
+
+
+bool LoadElimination::LoopMayWriteField(Node* effect_phi, Node* object,
+                                        const FieldAccess& access) {
+  DCHECK_EQ(IrOpcode::kEffectPhi, effect_phi->opcode());
+  Node* const control = NodeProperties::GetControlInput(effect_phi);
+  if (control->opcode() != IrOpcode::kLoop) return true;
+
+  // Visit every effect on the paths from the backedges to the loop header.
+  // All of them belong to the loop, including those of nested loops.
+  NodeSet::key_compare compare;
+  NodeSet visited(compare, NodeSet::allocator_type(zone_));
+  NodeVector stack(zone_);
+  int const input_count = OperatorProperties::GetEffectInputCount(
+      effect_phi->op());
+  for (int i = 1; i < input_count; ++i) {
+    stack.push_back(NodeProperties::GetEffectInput(effect_phi, i));
+  }
+  while (!stack.empty()) {
+    Node* const effect = stack.back();
+    stack.pop_back();
+    if (effect == effect_phi || !visited.insert(effect).second) continue;
+    if (visited.size() > kMaxLoopEffects) return true;
+    if (effect->opcode() == IrOpcode::kEffectPhi) {
+      int const count = OperatorProperties::GetEffectInputCount(effect->op());
+      for (int i = 0; i < count; ++i) {
+        stack.push_back(NodeProperties::GetEffectInput(effect, i));
+      }
+    } else if (MayWriteField(effect, object, access)) {
+      return true;
+    } else {
+      stack.push_back(NodeProperties::GetEffectInput(effect));
+    }
+  }
+  return false;
+}
+
+
+Reduction LoadElimination::ReduceLoadElement(Node* node) {
+  DCHECK_EQ(IrOpcode::kLoadElement, node->opcode());
+  ElementAccess const access = ElementAccessOf(node->op());
+  Node* const object = NodeProperties::GetValueInput(node, 0);
+  Node* const index = NodeProperties::GetValueInput(node, 1);
+  for (Node* effect = NodeProperties::GetEffectInput(node);;
+       effect = NodeProperties::GetEffectInput(effect)) {
+    switch (effect->opcode()) {
+      case IrOpcode::kLoadElement: {
+        if (object == NodeProperties::GetValueInput(effect, 0) &&
+            index == NodeProperties::GetValueInput(effect, 1) &&
+            IsSameElementAccess(access, ElementAccessOf(effect->op()))) {
+          NodeProperties::ReplaceWithValue(node, effect);
+          return Replace(effect);
+        }
+        break;
+      }
+      case IrOpcode::kStoreElement: {
+        Node* const other_object = NodeProperties::GetValueInput(effect, 0);
+        if (object == other_object &&
+            index == NodeProperties::GetValueInput(effect, 1) &&
+            IsSameElementAccess(access, ElementAccessOf(effect->op())) &&
+            CanForwardStoredValue(access.machine_type)) {
+          Node* const value = NodeProperties::GetValueInput(effect, 2);
+          NodeProperties::ReplaceWithValue(node, value);
+          return Replace(value);
+        }
+        // Different index nodes may still compute the same index.
+        if (access.base_is_tagged != kTaggedBase ||
+            ElementAccessOf(effect->op()).base_is_tagged != kTaggedBase ||
+            MayAlias(object, other_object)) {
+          return NoChange();
+        }
+        break;
+      }
+      case IrOpcode::kStoreField: {
+        // Field stores never write to the elements of another object.
+        if (access.base_is_tagged != kTaggedBase ||
+            FieldAccessOf(effect->op()).base_is_tagged != kTaggedBase ||
+            MayAlias(object, NodeProperties::GetValueInput(effect, 0))) {
+          return NoChange();
+        }
+        break;
+      }
+      default: {
+        if (!CanSkip(effect)) return NoChange();
+        break;
+      }
+    }
+  }
+  UNREACHABLE();
+  return NoChange();
+}
+
+
+Reduction LoadElimination::ReduceLoad(Node* node) {
+  DCHECK_EQ(IrOpcode::kLoad, node->opcode());
+  MachineType const rep = OpParameter<MachineType>(node);
+  Node* const base = NodeProperties::GetValueInput(node, 0);
+  Node* const index = NodeProperties::GetValueInput(node, 1);
+  Int32Matcher const offset(index);
+  for (Node* effect = NodeProperties::GetEffectInput(node);;
+       effect = NodeProperties::GetEffectInput(effect)) {
+    switch (effect->opcode()) {
+      case IrOpcode::kLoad: {
+        if (base == NodeProperties::GetValueInput(effect, 0) &&
+            index == NodeProperties::GetValueInput(effect, 1) &&
+            rep == OpParameter<MachineType>(effect)) {
+          NodeProperties::ReplaceWithValue(node, effect);
+          return Replace(effect);
+        }
+        break;
+      }
+      case IrOpcode::kStore: {
+        // Raw memory carries no object identity, so only stores through the
+        // same base at a known disjoint offset can be stepped over.
+        MachineType const other_rep =
+            OpParameter<StoreRepresentation>(effect).machine_type;
+        if (base != NodeProperties::GetValueInput(effect, 0)) {
+          return NoChange();
+        }
+        Node* const other_index = NodeProperties::GetValueInput(effect, 1);
+        if (index == other_index) {
+          if (rep == other_rep && CanForwardStoredValue(rep)) {
+            Node* const value = NodeProperties::GetValueInput(effect, 2);
+            NodeProperties::ReplaceWithValue(node, value);
+            return Replace(value);
+          }
+          return NoChange();
+        }
+        Int32Matcher const other_offset(other_index);
+        if (!offset.HasValue() || !other_offset.HasValue() ||
+            Overlaps(offset.Value(), rep, other_offset.Value(), other_rep)) {
+          return NoChange();
+        }
+        break;
+      }
+      default: {
+        if (!CanSkip(effect)) return NoChange();
+        break;
+      }
+    }
+  }
+  UNREACHABLE();
+  return NoChange();
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -0,0 +1,54 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_COMPILER_LOAD_ELIMINATION_H_
+#define V8_COMPILER_LOAD_ELIMINATION_H_
+
+#include "src/compiler/graph-reducer.h"
+#include "src/compiler/simplified-operator.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+// Eliminates loads that are redundant along the effect chain. A load is
+// replaced by an earlier load of the same location, or by the value of an
+// earlier store to it (store-to-load forwarding), provided that no effectful
+// operation in between may have written to that location. Handles both the
+// simplified LoadField/LoadElement operators and the machine Load operator.
+//
+// Field loads are also looked up across loops that provably do not write to
+// the loaded field. If no earlier load or store is found, the load is made to
+// depend on the effect in front of the loop instead, which allows the
+// scheduler to hoist it out of the loop.
+class LoadElimination FINAL : public Reducer {
+ public:
+  explicit LoadElimination(Zone* zone) : zone_(zone) {}
+  virtual ~LoadElimination();
+
+  virtual Reduction Reduce(Node* node) OVERRIDE;
+
+ private:
+  // Upper bound on the number of effects visited in a single loop.
+  static const size_t kMaxLoopEffects = 1000;
+
+  Reduction ReduceLoadField(Node* node);
+  Reduction ReduceLoadElement(Node* node);
+  Reduction ReduceLoad(Node* node);
+
+  // Returns true unless {effect_phi} is the effect phi of a loop whose body
+  // is known to leave the field described by {access} of {object} untouched.
+  bool LoopMayWriteField(Node* effect_phi, Node* object,
+                         const FieldAccess& access);
+
+  Zone* zone_;
+
+  DISALLOW_COPY_AND_ASSIGN(LoadElimination);
+};
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_COMPILER_LOAD_ELIMINATION_H_
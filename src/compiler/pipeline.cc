@@ -16,6 +16,8 @@
 #include "src/compiler/js-generic-lowering.h"
 #include "src/compiler/js-inlining.h"
 #include "src/compiler/js-typed-lowering.h"
+#include "src/compiler/jump-threading.h"
+#include "src/compiler/load-elimination.h"
 #include "src/compiler/machine-operator-reducer.h"
 #include "src/compiler/phi-reducer.h"
 #include "src/compiler/register-allocator.h"
@@ -43,12 +45,17 @@ class PhaseStats {
         kind_(kind),
         name_(name),
         size_(info->zone()->allocation_size()) {
-    if (FLAG_turbo_stats) {
+    if (FLAG_turbo_stats || FLAG_compile_stats) {
       timer_.Start();
     }
   }
 
   ~PhaseStats() {
+    if (FLAG_compile_stats) {
+      size_t bytes = info_->zone()->allocation_size() - size_;
+      info_->isolate()->compilation_statistics()->RecordPhase(
+          CompilationStatistics::TURBOFAN, name_, timer_.Elapsed(), bytes);
+    }
     if (FLAG_turbo_stats) {
       base::TimeDelta delta = timer_.Elapsed();
       size_t bytes = info_->zone()->allocation_size() - size_;
@@ -151,6 +158,12 @@ static void TraceSchedule(Schedule* schedule) {
 
 
 Handle<Code> Pipeline::GenerateCode() {
+  if (!CreateGraph() || !GenerateInstructions()) return Handle<Code>::null();
+  return FinishCode();
+}
+
+
+bool Pipeline::CreateGraph() {
   if (FLAG_turbo_stats) isolate()->GetTStatistics()->Initialize(info_);
 
   if (FLAG_trace_turbo) {
@@ -162,21 +175,22 @@ Handle<Code> Pipeline::GenerateCode() {
   }
 
   // Build the graph.
-  Graph graph(zone());
-  SourcePositionTable source_positions(&graph);
-  source_positions.AddDecorator();
+  Graph* graph = new (zone()) Graph(zone());
+  SourcePositionTable* source_positions =
+      new (zone()) SourcePositionTable(graph);
+  source_positions->AddDecorator();
   // TODO(turbofan): there is no need to type anything during initial graph
   // construction.  This is currently only needed for the node cache, which the
   // typer could sweep over later.
   Typer typer(zone());
   CommonOperatorBuilder common(zone());
-  JSGraph jsgraph(&graph, &common, &typer);
+  JSGraph jsgraph(graph, &common, &typer);
   Node* context_node;
   {
     PhaseStats graph_builder_stats(info(), PhaseStats::CREATE_GRAPH,
                                    "graph builder");
     AstGraphBuilderWithPositions graph_builder(info(), &jsgraph,
-                                               &source_positions);
+                                               source_positions);
     graph_builder.CreateGraph();
     context_node = graph_builder.GetFunctionContext();
   }
@@ -184,7 +198,7 @@ Handle<Code> Pipeline::GenerateCode() {
     PhaseStats phi_reducer_stats(info(), PhaseStats::CREATE_GRAPH,
                                  "phi reduction");
     PhiReducer phi_reducer;
-    GraphReducer graph_reducer(&graph);
+    GraphReducer graph_reducer(graph);
     graph_reducer.AddReducer(&phi_reducer);
     graph_reducer.ReduceGraph();
     // TODO(mstarzinger): Running reducer once ought to be enough for everyone.
@@ -192,118 +206,153 @@ Handle<Code> Pipeline::GenerateCode() {
     graph_reducer.ReduceGraph();
   }
 
-  VerifyAndPrintGraph(&graph, "Initial untyped");
+  VerifyAndPrintGraph(graph, "Initial untyped");
 
   if (info()->is_context_specializing()) {
-    SourcePositionTable::Scope pos(&source_positions,
-                                   SourcePosition::Unknown());
+    SourcePositionTable::Scope pos(source_positions,
+                                  SourcePosition::Unknown());
     // Specialize the code to the context as aggressively as possible.
     JSContextSpecializer spec(info(), &jsgraph, context_node);
     spec.SpecializeToContext();
-    VerifyAndPrintGraph(&graph, "Context specialized");
+    VerifyAndPrintGraph(graph, "Context specialized");
   }
 
   if (info()->is_inlining_enabled()) {
-    SourcePositionTable::Scope pos(&source_positions,
-                                   SourcePosition::Unknown());
+    SourcePositionTable::Scope pos(source_positions,
+                                  SourcePosition::Unknown());
     JSInliner inliner(info(), &jsgraph);
     inliner.Inline();
-    VerifyAndPrintGraph(&graph, "Inlined");
+    VerifyAndPrintGraph(graph, "Inlined");
   }
 
   // Print a replay of the initial graph.
   if (FLAG_print_turbo_replay) {
-    GraphReplayPrinter::PrintReplay(&graph);
+    GraphReplayPrinter::PrintReplay(graph);
   }
 
   if (info()->is_typing_enabled()) {
     {
       // Type the graph.
       PhaseStats typer_stats(info(), PhaseStats::CREATE_GRAPH, "typer");
-      typer.Run(&graph, info()->context());
-      VerifyAndPrintGraph(&graph, "Typed");
+      typer.Run(graph, info()->context());
+      VerifyAndPrintGraph(graph, "Typed");
     }
     // All new nodes must be typed.
-    typer.DecorateGraph(&graph);
+    typer.DecorateGraph(graph);
     {
       // Lower JSOperators where we can determine types.
       PhaseStats lowering_stats(info(), PhaseStats::CREATE_GRAPH,
                                 "typed lowering");
-      SourcePositionTable::Scope pos(&source_positions,
-                                     SourcePosition::Unknown());
+      SourcePositionTable::Scope pos(source_positions,
+                                    SourcePosition::Unknown());
       JSTypedLowering lowering(&jsgraph);
-      GraphReducer graph_reducer(&graph);
+      GraphReducer graph_reducer(graph);
       graph_reducer.AddReducer(&lowering);
       graph_reducer.ReduceGraph();
 
-      VerifyAndPrintGraph(&graph, "Lowered typed");
+      VerifyAndPrintGraph(graph, "Lowered typed");
+    }
+    if (FLAG_turbo_load_elimination) {
+      // Remove loads that are redundant along the effect chain.
+      PhaseStats load_elimination_stats(info(), PhaseStats::OPTIMIZATION,
+                                        "load elimination");
+      SourcePositionTable::Scope pos(source_positions,
+                                    SourcePosition::Unknown());
+      LoadElimination load_elimination(zone());
+      GraphReducer graph_reducer(graph);
+      graph_reducer.AddReducer(&load_elimination);
+      graph_reducer.ReduceGraph();
+
+      VerifyAndPrintGraph(graph, "Load eliminated");
     }
     {
       // Lower simplified operators and insert changes.
       PhaseStats lowering_stats(info(), PhaseStats::CREATE_GRAPH,
                                 "simplified lowering");
-      SourcePositionTable::Scope pos(&source_positions,
-                                     SourcePosition::Unknown());
+      SourcePositionTable::Scope pos(source_positions,
+                                    SourcePosition::Unknown());
       SimplifiedLowering lowering(&jsgraph);
       lowering.LowerAllNodes();
 
-      VerifyAndPrintGraph(&graph, "Lowered simplified");
+      VerifyAndPrintGraph(graph, "Lowered simplified");
     }
     {
       // Lower changes that have been inserted before.
       PhaseStats lowering_stats(info(), PhaseStats::OPTIMIZATION,
                                 "change lowering");
-      SourcePositionTable::Scope pos(&source_positions,
-                                     SourcePosition::Unknown());
+      SourcePositionTable::Scope pos(source_positions,
+                                    SourcePosition::Unknown());
       Linkage linkage(info());
       MachineOperatorBuilder machine(zone());
       ValueNumberingReducer vn_reducer(zone());
       SimplifiedOperatorReducer simple_reducer(&jsgraph, &machine);
       ChangeLowering lowering(&jsgraph, &linkage, &machine);
       MachineOperatorReducer mach_reducer(&jsgraph);
-      GraphReducer graph_reducer(&graph);
+      LoadElimination load_elimination(zone());
+      GraphReducer graph_reducer(graph);
       // TODO(titzer): Figure out if we should run all reducers at once here.
       graph_reducer.AddReducer(&vn_reducer);
       graph_reducer.AddReducer(&simple_reducer);
       graph_reducer.AddReducer(&lowering);
       graph_reducer.AddReducer(&mach_reducer);
+      if (FLAG_turbo_load_elimination) {
+        // Lowering exposes machine loads from the same base and offset.
+        graph_reducer.AddReducer(&load_elimination);
+      }
       graph_reducer.ReduceGraph();
 
-      VerifyAndPrintGraph(&graph, "Lowered changes");
+      VerifyAndPrintGraph(graph, "Lowered changes");
     }
   }
 
-  Handle<Code> code = Handle<Code>::null();
-  if (SupportedTarget()) {
-    {
-      // Lower any remaining generic JSOperators.
-      PhaseStats lowering_stats(info(), PhaseStats::CREATE_GRAPH,
-                                "generic lowering");
-      SourcePositionTable::Scope pos(&source_positions,
-                                     SourcePosition::Unknown());
-      MachineOperatorBuilder machine(zone());
-      JSGenericLowering lowering(info(), &jsgraph, &machine);
-      GraphReducer graph_reducer(&graph);
-      graph_reducer.AddReducer(&lowering);
-      graph_reducer.ReduceGraph();
+  if (!SupportedTarget()) return false;
+  {
+    // Lower any remaining generic JSOperators.
+    PhaseStats lowering_stats(info(), PhaseStats::CREATE_GRAPH,
+                              "generic lowering");
+    SourcePositionTable::Scope pos(source_positions,
+                                  SourcePosition::Unknown());
+    MachineOperatorBuilder machine(zone());
+    JSGenericLowering lowering(info(), &jsgraph, &machine);
+    GraphReducer graph_reducer(graph);
+    graph_reducer.AddReducer(&lowering);
+    graph_reducer.ReduceGraph();
 
-      VerifyAndPrintGraph(&graph, "Lowered generic");
-    }
+    VerifyAndPrintGraph(graph, "Lowered generic");
+  }
 
-    {
-      // Compute a schedule.
-      Schedule* schedule = ComputeSchedule(&graph);
-      // Generate optimized code.
-      PhaseStats codegen_stats(info(), PhaseStats::CODEGEN, "codegen");
-      Linkage linkage(info());
-      code = GenerateCode(&linkage, &graph, schedule, &source_positions);
-      info()->SetCode(code);
-    }
+  // No nodes are added past this point. The graph, the source positions and
+  // the linkage are zone allocated so that {GenerateInstructions} can pick
+  // them up later. The linkage is computed here because it may read the
+  // parameter count from the closure.
+  source_positions->RemoveDecorator();
+  graph_ = graph;
+  source_positions_ = source_positions;
+  linkage_ = new (zone()) Linkage(info());
+  return true;
+}
+
+
+bool Pipeline::GenerateInstructions() {
+  DCHECK_NOT_NULL(graph_);
+  Schedule* schedule = ComputeSchedule(graph_);
+  return SelectInstructions(linkage_, graph_, schedule, source_positions_) &&
+         AllocateRegisters();
+}
 
-    // Print optimized code.
-    v8::internal::CodeGenerator::PrintCode(code, info());
+
+Handle<Code> Pipeline::FinishCode() {
+  Handle<Code> code;
+  {
+    // Generate optimized code.
+    PhaseStats codegen_stats(info(), PhaseStats::CODEGEN, "codegen");
+    code = AssembleCode();
+    info()->SetCode(code);
   }
 
+  // Print optimized code.
+  v8::internal::CodeGenerator::PrintCode(code, info());
+
   if (FLAG_trace_turbo) {
     OFStream os(stdout);
     os << "--------------------------------------------------\n"
@@ -336,7 +385,11 @@ Handle<Code> Pipeline::GenerateCodeForMachineGraph(Linkage* linkage,
   TraceSchedule(schedule);
 
   SourcePositionTable source_positions(graph);
-  Handle<Code> code = GenerateCode(linkage, graph, schedule, &source_positions);
+  if (!SelectInstructions(linkage, graph, schedule, &source_positions) ||
+      !AllocateRegisters()) {
+    return Handle<Code>::null();
+  }
+  Handle<Code> code = AssembleCode();
 #if ENABLE_DISASSEMBLER
   if (!code.is_null() && FLAG_print_opt_code) {
     CodeTracer::Scope tracing_scope(isolate()->GetCodeTracer());
@@ -348,50 +401,66 @@ Handle<Code> Pipeline::GenerateCodeForMachineGraph(Linkage* linkage,
 }
 
 
-Handle<Code> Pipeline::GenerateCode(Linkage* linkage, Graph* graph,
-                                    Schedule* schedule,
-                                    SourcePositionTable* source_positions) {
+bool Pipeline::SelectInstructions(Linkage* linkage, Graph* graph,
+                                  Schedule* schedule,
+                                  SourcePositionTable* source_positions) {
   DCHECK_NOT_NULL(graph);
   DCHECK_NOT_NULL(linkage);
   DCHECK_NOT_NULL(schedule);
   CHECK(SupportedBackend());
 
-  InstructionSequence sequence(linkage, graph, schedule);
+  if (graph->NodeCount() > UnallocatedOperand::kMaxVirtualRegisters) {
+    linkage->info()->set_bailout_reason(kNotEnoughVirtualRegistersForValues);
+    return false;
+  }
+
+  sequence_ = new (zone()) InstructionSequence(linkage, graph, schedule);
 
   // Select and schedule instructions covering the scheduled graph.
   {
-    InstructionSelector selector(&sequence, source_positions);
+    PhaseStats selection_stats(info(), PhaseStats::CODEGEN,
+                               "instruction selection");
+    InstructionSelector selector(sequence_, source_positions);
     selector.SelectInstructions();
   }
 
   if (FLAG_trace_turbo) {
     OFStream os(stdout);
     os << "----- Instruction sequence before register allocation -----\n"
-       << sequence;
+       << *sequence_;
   }
+  return true;
+}
 
-  // Allocate registers.
-  {
-    int node_count = graph->NodeCount();
-    if (node_count > UnallocatedOperand::kMaxVirtualRegisters) {
-      linkage->info()->set_bailout_reason(kNotEnoughVirtualRegistersForValues);
-      return Handle<Code>::null();
-    }
-    RegisterAllocator allocator(&sequence);
-    if (!allocator.Allocate()) {
-      linkage->info()->set_bailout_reason(kNotEnoughVirtualRegistersRegalloc);
-      return Handle<Code>::null();
-    }
+
+bool Pipeline::AllocateRegisters() {
+  DCHECK_NOT_NULL(sequence_);
+  RegisterAllocator allocator(sequence_);
+  if (!allocator.Allocate()) {
+    info()->set_bailout_reason(kNotEnoughVirtualRegistersRegalloc);
+    return false;
   }
 
+  if (FLAG_turbo_jump_threading) {
+    // Redirect jumps through empty blocks to their final targets.
+    JumpThreading::ApplyForwarding(sequence_);
+  }
+  return true;
+}
+
+
+Handle<Code> Pipeline::AssembleCode() {
+  DCHECK_NOT_NULL(sequence_);
+  // Printing the sequence dereferences constant handles, so it is done here
+  // on the main thread rather than in AllocateRegisters.
   if (FLAG_trace_turbo) {
     OFStream os(stdout);
     os << "----- Instruction sequence after register allocation -----\n"
-       << sequence;
+       << *sequence_;
   }
 
   // Generate native sequence.
-  CodeGenerator generator(&sequence);
+  CodeGenerator generator(sequence_);
   return generator.GenerateCode();
 }
 
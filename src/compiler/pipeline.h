@@ -21,14 +21,31 @@ class Graph;
 class Schedule;
 class SourcePositionTable;
 class Linkage;
+class InstructionSequence;
 
-class Pipeline {
+class Pipeline : public ZoneObject {
  public:
-  explicit Pipeline(CompilationInfo* info) : info_(info) {}
+  explicit Pipeline(CompilationInfo* info)
+      : info_(info),
+        graph_(NULL),
+        source_positions_(NULL),
+        linkage_(NULL),
+        sequence_(NULL) {}
 
   // Run the entire pipeline and generate a handle to a code object.
   Handle<Code> GenerateCode();
 
+  // The same pipeline split into the three phases of an optimized compile
+  // job. {CreateGraph} builds and lowers the graph; it returns false if no
+  // graph for the backend was produced. {GenerateInstructions} schedules the
+  // graph, selects instructions and allocates registers; unless tracing is
+  // on, it neither allocates nor dereferences heap objects and may run on the
+  // concurrent recompilation thread. {FinishCode} assembles the code object
+  // and sets it on the compilation info.
+  bool CreateGraph();
+  bool GenerateInstructions();
+  Handle<Code> FinishCode();
+
   // Run the pipeline on a machine graph and generate code. If {schedule}
   // is {NULL}, then compute a new schedule for code generation.
   Handle<Code> GenerateCodeForMachineGraph(Linkage* linkage, Graph* graph,
@@ -42,6 +59,10 @@ class Pipeline {
 
  private:
   CompilationInfo* info_;
+  Graph* graph_;
+  SourcePositionTable* source_positions_;
+  Linkage* linkage_;
+  InstructionSequence* sequence_;
 
   CompilationInfo* info() const { return info_; }
   Isolate* isolate() { return info_->isolate(); }
@@ -49,8 +70,10 @@ class Pipeline {
 
   Schedule* ComputeSchedule(Graph* graph);
   void VerifyAndPrintGraph(Graph* graph, const char* phase);
-  Handle<Code> GenerateCode(Linkage* linkage, Graph* graph, Schedule* schedule,
-                            SourcePositionTable* source_positions);
+  bool SelectInstructions(Linkage* linkage, Graph* graph, Schedule* schedule,
+                          SourcePositionTable* source_positions);
+  bool AllocateRegisters();
+  Handle<Code> AssembleCode();
 };
 }
 }
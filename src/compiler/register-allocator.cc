@@ -1743,14 +1743,20 @@ void RegisterAllocator::FreeSpillSlot(LiveRange* range) {
 
 
 InstructionOperand* RegisterAllocator::TryReuseSpillSlot(LiveRange* range) {
-  if (reusable_slots_.is_empty()) return NULL;
-  if (reusable_slots_.first()->End().Value() >
-      range->TopLevel()->Start().Value()) {
-    return NULL;
-  }
+  // Any slot whose previous owner ended before {range} starts can be shared.
+  // Pick the one freed last, keeping slots freed earlier for ranges that
+  // start earlier.
+  int start = range->TopLevel()->Start().Value();
+  int best = -1;
+  for (int i = 0; i < reusable_slots_.length(); ++i) {
+    int end = reusable_slots_[i]->End().Value();
+    if (end > start) continue;
+    if (best < 0 || end > reusable_slots_[best]->End().Value()) best = i;
+  }
+  if (best < 0) return NULL;
   InstructionOperand* result =
-      reusable_slots_.first()->TopLevel()->GetSpillOperand();
-  reusable_slots_.Remove(0);
+      reusable_slots_[best]->TopLevel()->GetSpillOperand();
+  reusable_slots_.Remove(best);
   return result;
 }
 
@@ -2208,7 +2214,8 @@ void RegisterAllocator::SetLiveRangeAssignedRegister(LiveRange* range,
 
 RegisterAllocatorPhase::RegisterAllocatorPhase(const char* name,
                                                RegisterAllocator* allocator)
-    : CompilationPhase(name, allocator->code()->linkage()->info()),
+    : CompilationPhase(name, allocator->code()->linkage()->info(),
+                       CompilationStatistics::TURBOFAN),
       allocator_(allocator) {
   if (FLAG_turbo_stats) {
     allocator_zone_start_allocation_size_ =
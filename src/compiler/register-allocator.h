@@ -17,10 +17,6 @@ namespace internal {
 
 // Forward declarations.
 class BitVector;
-class InstructionOperand;
-class UnallocatedOperand;
-class ParallelMove;
-class PointerMap;
 
 namespace compiler {
 
@@ -43,7 +43,7 @@ inline bool operator!=(const SourcePosition& lhs, const SourcePosition& rhs) {
 }
 
 
-class SourcePositionTable FINAL {
+class SourcePositionTable FINAL : public ZoneObject {
  public:
   class Scope {
    public:
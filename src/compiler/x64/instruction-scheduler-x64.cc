@@ -0,0 +1,138 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/instruction-scheduler.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+bool InstructionScheduler::SchedulerSupported() { return true; }
+
+
+int InstructionScheduler::GetTargetInstructionFlags(
+    const Instruction* instr) const {
+  switch (instr->arch_opcode()) {
+    case kX64Add:
+    case kX64Add32:
+    case kX64And:
+    case kX64And32:
+    case kX64Cmp:
+    case kX64Cmp32:
+    case kX64Test:
+    case kX64Test32:
+    case kX64Or:
+    case kX64Or32:
+    case kX64Xor:
+    case kX64Xor32:
+    case kX64Sub:
+    case kX64Sub32:
+    case kX64Imul:
+    case kX64Imul32:
+    case kX64Idiv:
+    case kX64Idiv32:
+    case kX64Udiv:
+    case kX64Udiv32:
+    case kX64Not:
+    case kX64Not32:
+    case kX64Neg:
+    case kX64Neg32:
+    case kX64Shl:
+    case kX64Shl32:
+    case kX64Shr:
+    case kX64Shr32:
+    case kX64Sar:
+    case kX64Sar32:
+    case kX64Ror:
+    case kX64Ror32:
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+    case kSSEFloat64Mul:
+    case kSSEFloat64Div:
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEInt32ToFloat64:
+    case kSSEUint32ToFloat64:
+      return kNoOpcodeFlags;
+
+    // The x87 remainder loop goes through the stack.
+    case kSSEFloat64Mod:
+      return kHasSideEffect;
+
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movb:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movw:
+    case kX64Movl:
+    case kX64Movsxlq:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+      // Without an addressing mode these are register to register moves.
+      if (instr->addressing_mode() == kMode_None) return kNoOpcodeFlags;
+      return instr->HasOutput() ? kIsLoadOperation : kHasSideEffect;
+
+    case kX64Push:
+    case kX64StoreWriteBarrier:
+      return kHasSideEffect;
+
+    default:
+      break;
+  }
+  UNREACHABLE();
+  return kNoOpcodeFlags;
+}
+
+
+int InstructionScheduler::GetInstructionLatency(
+    const Instruction* instr) const {
+  // Approximate latencies in cycles of current Intel cores.
+  switch (instr->arch_opcode()) {
+    case kX64Imul:
+    case kX64Imul32:
+      return 3;
+    case kX64Idiv32:
+    case kX64Udiv32:
+      return 26;
+    case kX64Idiv:
+    case kX64Udiv:
+      return 40;
+    case kSSEFloat64Cmp:
+    case kSSEFloat64Add:
+    case kSSEFloat64Sub:
+      return 3;
+    case kSSEFloat64Mul:
+      return 5;
+    case kSSEFloat64Div:
+      return 20;
+    case kSSEFloat64Mod:
+      return 50;
+    case kSSEFloat64ToInt32:
+    case kSSEFloat64ToUint32:
+    case kSSEInt32ToFloat64:
+    case kSSEUint32ToFloat64:
+      return 4;
+    case kX64Movsxbl:
+    case kX64Movzxbl:
+    case kX64Movsxwl:
+    case kX64Movzxwl:
+    case kX64Movl:
+    case kX64Movq:
+    case kX64Movsd:
+    case kX64Movss:
+      if (instr->HasOutput() && instr->addressing_mode() != kMode_None) {
+        return 4;
+      }
+      return 1;
+    default:
+      return 1;
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
@@ -45,8 +45,12 @@ class X64OperandGenerator FINAL : public OperandGenerator {
       case IrOpcode::kHeapConstant: {
         // Constants in new space cannot be used as immediates in V8 because
         // the GC does not scan code objects when collecting the new generation.
-        Handle<HeapObject> value = ValueOf<Handle<HeapObject> >(node->op());
-        return !isolate()->heap()->InNewSpace(*value);
+        // Instruction selection may run on the concurrent recompilation
+        // thread, so test the address recorded when the constant was created
+        // rather than dereference the handle. Objects never move back into
+        // new space, so a stale address errs on the safe side.
+        Unique<Object> value = ValueOf<Unique<Object> >(node->op());
+        return !isolate()->heap()->InNewSpace(value.raw_address());
       }
       default:
         return false;
@@ -291,9 +291,14 @@ class HistogramTimerScope BASE_EMBEDDED {
 #endif
 };
 
-#define HISTOGRAM_RANGE_LIST(HR) \
-  /* Generic range histograms */ \
-  HR(gc_idle_time_allotted_in_ms, V8.GCIdleTimeAllottedInMS, 0, 10000, 101)
+#define HISTOGRAM_RANGE_LIST(HR)                                             \
+  /* Generic range histograms */                                             \
+  HR(gc_idle_time_allotted_in_ms, V8.GCIdleTimeAllottedInMS, 0, 10000, 101)  \
+  HR(concurrent_recompilation_queue_wait_in_ms,                              \
+     V8.ConcurrentRecompilationQueueWaitInMS, 0, 10000, 101)                 \
+  HR(stub_cache_primary_occupancy, V8.StubCachePrimaryOccupancy, 0, 100, 21) \
+  HR(stub_cache_secondary_occupancy, V8.StubCacheSecondaryOccupancy, 0, 100, \
+     21)
 
 #define HISTOGRAM_TIMER_LIST(HT)                             \
   /* Garbage collection timers. */                           \
@@ -310,7 +315,10 @@ class HistogramTimerScope BASE_EMBEDDED {
   /* Total compilation times. */                             \
   HT(compile, V8.Compile)                                    \
   HT(compile_eval, V8.CompileEval)                           \
-  HT(compile_lazy, V8.CompileLazy)
+  HT(compile_lazy, V8.CompileLazy)                           \
+  /* Main-thread part of optimizing compiles, including */   \
+  /* Crankshaft graph building of concurrent jobs. */        \
+  HT(recompile_synchronous, V8.RecompileSynchronous)
 
 #define HISTOGRAM_PERCENTAGE_LIST(HP)                                 \
   /* Heap fragmentation. */                                           \
@@ -379,6 +387,7 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(memory_allocated, V8.OsMemoryAllocated)                          \
   SC(normalized_maps, V8.NormalizedMaps)                              \
   SC(props_to_dictionary, V8.ObjectPropertiesToDictionary)            \
+  SC(props_to_fast_reoptimized, V8.ObjectPropertiesReoptimized)       \
   SC(elements_to_dictionary, V8.ObjectElementsToDictionary)           \
   SC(alive_after_last_gc, V8.AliveAfterLastGC)                        \
   SC(objs_since_last_young, V8.ObjsSinceLastYoung)                    \
@@ -405,6 +414,8 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(total_load_size, V8.TotalLoadSize)                               \
   /* Amount of parsed source code. */                                 \
   SC(total_parse_size, V8.TotalParseSize)                             \
+  /* Amount of zone memory allocated for ASTs of parsed source code. */ \
+  SC(total_ast_size, V8.TotalAstSize)                                 \
   /* Amount of source code skipped over using preparsing. */          \
   SC(total_preparse_skipped, V8.TotalPreparseSkipped)                 \
   /* Number of symbol lookups skipped using preparsing */             \
@@ -413,6 +424,17 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(total_compile_size, V8.TotalCompileSize)                         \
   /* Amount of source code compiled with the full codegen. */         \
   SC(total_full_codegen_source_size, V8.TotalFullCodegenSourceSize)   \
+  /* Functions queued for concurrent recompilation, and functions */  \
+  /* that could not be queued because the queue was full. */          \
+  SC(concurrent_recompilation_queued,                                 \
+     V8.ConcurrentRecompilationQueued)                                \
+  SC(concurrent_recompilation_dropped,                                \
+     V8.ConcurrentRecompilationDropped)                               \
+  /* Stack slots and non-redundant gap moves in TurboFan code, and */ \
+  /* the subset of those moves that read or write a stack slot. */    \
+  SC(turbo_stack_slots, V8.TurboStackSlots)                           \
+  SC(turbo_gap_moves, V8.TurboGapMoves)                               \
+  SC(turbo_stack_slot_moves, V8.TurboStackSlotMoves)                  \
   /* Number of contexts created from scratch. */                      \
   SC(contexts_created_from_scratch, V8.ContextsCreatedFromScratch)    \
   /* Number of contexts created by partial snapshot. */               \
@@ -457,6 +479,8 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(named_store_global_inline, V8.NamedStoreGlobalInline)            \
   SC(named_store_global_inline_miss, V8.NamedStoreGlobalInlineMiss)   \
   SC(keyed_store_polymorphic_stubs, V8.KeyedStorePolymorphicStubs)    \
+  SC(keyed_store_generic_dictionary, V8.KeyedStoreGenericDictionary)  \
+  SC(load_callback_handler_reused, V8.LoadCallbackHandlerReused)      \
   SC(keyed_store_external_array_slow, V8.KeyedStoreExternalArraySlow) \
   SC(store_normal_miss, V8.StoreNormalMiss)                           \
   SC(store_normal_hit, V8.StoreNormalHit)                             \
@@ -478,14 +502,21 @@ class HistogramTimerScope BASE_EMBEDDED {
   SC(negative_lookups, V8.NegativeLookups)                            \
   SC(negative_lookups_miss, V8.NegativeLookupsMiss)                   \
   SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)    \
+  SC(megamorphic_stub_cache_secondary_probes,                         \
+     V8.MegamorphicStubCacheSecondaryProbes)                          \
   SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)    \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)  \
+  SC(megamorphic_stub_cache_evictions,                                \
+     V8.MegamorphicStubCacheEvictions)                                \
   SC(array_function_runtime, V8.ArrayFunctionRuntime)                 \
   SC(array_function_native, V8.ArrayFunctionNative)                   \
   SC(for_in, V8.ForIn)                                                \
   SC(enum_cache_hits, V8.EnumCacheHits)                               \
   SC(enum_cache_misses, V8.EnumCacheMisses)                           \
   SC(zone_segment_bytes, V8.ZoneSegmentBytes)                         \
+  SC(zone_segments_reused, V8.ZoneSegmentsReused)                     \
+  SC(zone_segment_pool_bytes_held, V8.ZoneSegmentPoolBytesHeld)       \
+  SC(zone_segment_pool_bytes_in_use, V8.ZoneSegmentPoolBytesInUse)    \
   SC(fast_new_closure_total, V8.FastNewClosureTotal)                  \
   SC(fast_new_closure_try_optimized, V8.FastNewClosureTryOptimized)   \
   SC(fast_new_closure_install_optimized, V8.FastNewClosureInstallOptimized) \
@@ -1347,6 +1347,11 @@ bool Shell::SetOptions(int argc, char* argv[]) {
       options.dump_heap_constants = true;
       argv[i] = NULL;
 #endif  // V8_SHARED
+    } else if (strcmp(argv[i], "--dump-compile-stats") == 0) {
+      options.dump_compile_stats = true;
+      argv[i] = NULL;
+      const char* flag = "--compile-stats";
+      v8::V8::SetFlagsFromString(flag, static_cast<int>(strlen(flag)));
     } else if (strcmp(argv[i], "--throws") == 0) {
       options.expected_to_throw = true;
       argv[i] = NULL;
@@ -1459,6 +1464,22 @@ int Shell::RunMain(Isolate* isolate, int argc, char* argv[]) {
 }
 
 
+// Prints the per-phase compiler statistics as JSON.
+static void DumpCompileStatistics(Isolate* isolate) {
+  printf("{\"compile_phases\": [");
+  int count = isolate->NumberOfCompilePhases();
+  for (int i = 0; i < count; i++) {
+    CompilePhaseStatistics stats;
+    if (!isolate->GetCompilePhaseStatistics(i, &stats)) break;
+    printf("%s\n  {\"tier\": \"%s\", \"phase\": \"%s\", \"count\": %d, "
+           "\"time_ms\": %.3f, \"zone_bytes\": %u}",
+           i == 0 ? "" : ",", stats.tier(), stats.phase(), stats.count(),
+           stats.time_in_ms(), static_cast<unsigned>(stats.zone_bytes()));
+  }
+  printf("\n]}\n");
+}
+
+
 #ifndef V8_SHARED
 static void DumpHeapConstants(i::Isolate* isolate) {
   i::Heap* heap = isolate->heap();
@@ -1679,6 +1700,8 @@ int Shell::Main(int argc, char* argv[]) {
 #endif  // !V8_SHARED
       RunShell(isolate);
     }
+
+    if (options.dump_compile_stats) DumpCompileStatistics(isolate);
   }
   isolate->Dispose();
   V8::Dispose();
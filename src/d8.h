@@ -205,6 +205,7 @@ class ShellOptions {
         interactive_shell(false),
         test_shell(false),
         dump_heap_constants(false),
+        dump_compile_stats(false),
         expected_to_throw(false),
         mock_arraybuffer_allocator(false),
         num_isolates(1),
@@ -231,6 +232,7 @@ class ShellOptions {
   bool interactive_shell;
   bool test_shell;
   bool dump_heap_constants;
+  bool dump_compile_stats;
   bool expected_to_throw;
   bool mock_arraybuffer_allocator;
   int num_isolates;
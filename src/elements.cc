@@ -747,6 +747,23 @@ class ElementsAccessorBase : public ElementsAccessor {
         from, from_start, to, from_kind, to_start, packed_size, copy_size);
   }
 
+  static void FillImpl(Handle<FixedArrayBase> backing_store,
+                       Handle<Object> value,
+                       uint32_t start,
+                       uint32_t end) {
+    UNREACHABLE();
+  }
+
+  virtual void Fill(
+      Handle<FixedArrayBase> backing_store,
+      Handle<Object> value,
+      uint32_t start,
+      uint32_t end) FINAL OVERRIDE {
+    DCHECK(start <= end);
+    DCHECK(end <= static_cast<uint32_t>(backing_store->length()));
+    ElementsAccessorSubclass::FillImpl(backing_store, value, start, end);
+  }
+
   virtual MaybeHandle<FixedArray> AddElementsToFixedArray(
       Handle<Object> receiver,
       Handle<JSObject> holder,
@@ -1101,6 +1118,29 @@ class FastSmiOrObjectElementsAccessor
   }
 
 
+  static void FillImpl(Handle<FixedArrayBase> backing_store,
+                       Handle<Object> value,
+                       uint32_t start,
+                       uint32_t end) {
+    DCHECK(value->IsSmi() || IsFastObjectElementsKind(KindTraits::Kind));
+    Heap* heap = backing_store->GetHeap();
+    DCHECK(backing_store->map() != heap->fixed_cow_array_map());
+    DisallowHeapAllocation no_gc;
+    FixedArray* array = FixedArray::cast(*backing_store);
+    int length = end - start;
+    if (length == 0) return;
+    MemsetPointer(array->data_start() + start, *value, length);
+    // Every slot holds the same value, so the write barrier only has to
+    // look at it once.
+    if (value->IsHeapObject()) {
+      if (!heap->InNewSpace(array) && heap->InNewSpace(*value)) {
+        heap->RecordWrites(array->address(), array->OffsetOfElementAt(start),
+                           length);
+      }
+      heap->incremental_marking()->RecordWrites(array);
+    }
+  }
+
   static void SetFastElementsCapacityAndLength(
       Handle<JSObject> obj,
       uint32_t capacity,
@@ -1178,6 +1218,17 @@ class FastDoubleElementsAccessor
     JSObject::SetFastDoubleElementsCapacityAndLength(obj, capacity, length);
   }
 
+  static void FillImpl(Handle<FixedArrayBase> backing_store,
+                       Handle<Object> value,
+                       uint32_t start,
+                       uint32_t end) {
+    DCHECK(value->IsNumber());
+    DisallowHeapAllocation no_gc;
+    FixedDoubleArray* array = FixedDoubleArray::cast(*backing_store);
+    double number = value->Number();
+    for (uint32_t i = start; i < end; i++) array->set(i, number);
+  }
+
  protected:
   static void CopyElementsImpl(Handle<FixedArrayBase> from,
                                uint32_t from_start,
@@ -165,6 +165,15 @@ class ElementsAccessor {
       *from_holder, 0, from_kind, to, 0, kCopyToEndAndInitializeToHole);
   }
 
+  // Stores |value| into the elements of |backing_store| in the range
+  // [start, end). The backing store must be writable and of a kind that can
+  // hold the value. Only fast elements kinds support this.
+  virtual void Fill(
+      Handle<FixedArrayBase> backing_store,
+      Handle<Object> value,
+      uint32_t start,
+      uint32_t end) = 0;
+
   MUST_USE_RESULT virtual MaybeHandle<FixedArray> AddElementsToFixedArray(
       Handle<Object> receiver,
       Handle<JSObject> holder,
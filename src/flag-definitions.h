@@ -237,6 +237,8 @@ DEFINE_BOOL(fast_math, true, "faster (but maybe less accurate) math functions")
 DEFINE_BOOL(collect_megamorphic_maps_from_stub_cache, true,
             "crankshaft harvests type feedback from stub cache")
 DEFINE_BOOL(hydrogen_stats, false, "print statistics for hydrogen")
+DEFINE_BOOL(compile_stats, false,
+            "collect time and zone statistics for all compiler phases")
 DEFINE_BOOL(trace_check_elimination, false, "trace check elimination phase")
 DEFINE_BOOL(trace_hydrogen, false, "trace generated hydrogen to file")
 DEFINE_STRING(trace_hydrogen_filter, "*", "hydrogen tracing filter")
@@ -258,6 +260,13 @@ DEFINE_BOOL(trace_track_allocation_sites, false,
             "trace the tracking of allocation sites")
 DEFINE_BOOL(trace_migration, false, "trace object migration")
 DEFINE_BOOL(trace_generalization, false, "trace map generalization")
+DEFINE_BOOL(trace_property_normalization, false,
+            "trace objects switching between fast and dictionary properties")
+DEFINE_BOOL(reoptimize_dictionary_objects, true,
+            "migrate stable dictionary mode objects back to fast properties")
+DEFINE_INT(dictionary_reoptimize_threshold, 16,
+           "loads from a dictionary mode object without added or removed "
+           "properties before it is migrated back to fast properties")
 DEFINE_BOOL(stress_pointer_maps, false, "pointer map for every instruction")
 DEFINE_BOOL(stress_environments, false, "environment for every instruction")
 DEFINE_INT(deopt_every_n_times, 0,
@@ -312,6 +321,8 @@ DEFINE_BOOL(trace_concurrent_recompilation, false,
             "track concurrent recompilation")
 DEFINE_INT(concurrent_recompilation_queue_length, 8,
            "the length of the concurrent compilation queue")
+DEFINE_INT(concurrent_recompilation_threads, 1,
+           "the number of concurrent compiler threads")
 DEFINE_INT(concurrent_recompilation_delay, 0,
            "artificial compilation delay in ms")
 DEFINE_BOOL(block_concurrent_recompilation, false,
@@ -338,6 +349,14 @@ DEFINE_BOOL(context_specialization, false,
 DEFINE_BOOL(turbo_deoptimization, false, "enable deoptimization in TurboFan")
 DEFINE_BOOL(turbo_inlining, false, "enable inlining in TurboFan")
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_BOOL(turbo_load_elimination, true,
+            "eliminate redundant loads in TurboFan")
+DEFINE_BOOL(turbo_load_hoisting, true,
+            "hoist loop invariant field loads in TurboFan")
+DEFINE_BOOL(turbo_jump_threading, true,
+            "thread jumps through empty blocks in TurboFan")
+DEFINE_BOOL(turbo_instruction_scheduling, false,
+            "schedule instructions by latency in TurboFan")
 
 DEFINE_INT(typed_array_max_size_in_heap, 64,
            "threshold for in-heap typed array")
@@ -544,8 +563,22 @@ DEFINE_BOOL(use_idle_notification, true,
             "Use idle notification to reduce memory footprint.")
 // ic.cc
 DEFINE_BOOL(use_ic, true, "use inline caching")
+DEFINE_INT(max_polymorphism, 4,
+           "maximum number of maps a named property IC handles before it "
+           "goes megamorphic")
+DEFINE_BOOL(shape_family_ics, true,
+            "let load ICs that exceed max_polymorphism dispatch on a shared "
+            "descriptor array instead of going megamorphic")
+DEFINE_BOOL(share_api_load_handlers, true,
+            "share load handlers for API accessors across native contexts")
 DEFINE_BOOL(trace_ic, false, "trace inline cache state transitions")
 
+// stub-cache.cc
+DEFINE_INT(stub_cache_primary_bits, 11,
+           "log2 of the number of entries in the primary stub cache table")
+DEFINE_INT(stub_cache_secondary_bits, 9,
+           "log2 of the number of entries in the secondary stub cache table")
+
 // macro-assembler-ia32.cc
 DEFINE_BOOL(native_code_counters, false,
             "generate extra code for manipulating stats counters")
@@ -576,6 +609,8 @@ DEFINE_BOOL(use_verbose_printer, true, "allows verbose printing")
 // parser.cc
 DEFINE_BOOL(allow_natives_syntax, false, "allow natives syntax")
 DEFINE_BOOL(trace_parse, false, "trace parsing and preparsing")
+DEFINE_BOOL(trace_ast_size, false,
+            "report the bytes of AST allocated per byte of parsed source")
 
 // simulator-arm.cc, simulator-arm64.cc and simulator-mips.cc
 DEFINE_BOOL(trace_sim, false, "Trace simulator execution")
@@ -621,6 +656,10 @@ DEFINE_BOOL(profile_deserialization, false,
 // Regexp
 DEFINE_BOOL(regexp_optimization, true, "generate optimized regexp code")
 
+// zone.cc
+DEFINE_INT(zone_segment_pool_size, 8,
+           "maximum size in MB of unused zone segments kept for reuse")
+
 // Testing flags test/cctest/test-{flags,api,serialization}.cc
 DEFINE_BOOL(testing_bool_flag, true, "testing_bool_flag")
 DEFINE_MAYBE_BOOL(testing_maybe_bool_flag, "testing_maybe_bool_flag")
@@ -293,6 +293,8 @@ bool FullCodeGenerator::MakeCode(CompilationInfo* info) {
   Isolate* isolate = info->isolate();
 
   TimerEventScope<TimerEventCompileFullCode> timer(info->isolate());
+  CompilationStatistics::PhaseScope stats(
+      isolate, info->zone(), CompilationStatistics::FULL_CODEGEN, "codegen");
 
   Handle<Script> script = info->script();
   if (!script->IsUndefined() && !script->source()->IsUndefined()) {
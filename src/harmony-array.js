@@ -118,6 +118,11 @@ function ArrayFill(value /* [, start [, end ] ] */) {  // length == 1
                         ["Array.prototype.fill"]);
   }
 
+  // Arrays in fast mode are filled in place when no setters can be called.
+  if (IS_ARRAY(array) && %FillFastElements(array, value, i, end)) {
+    return array;
+  }
+
   for (; i < end; i++)
     array[i] = value;
   return array;
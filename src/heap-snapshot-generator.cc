@@ -1265,9 +1265,26 @@ void V8HeapExplorer::ExtractSymbolReferences(int entry, Symbol* symbol) {
 }
 
 
+// Names the backing store of a Map or Set after its occupancy, so that
+// oversized or hole-ridden tables stand out in the snapshot.
+template <class Table>
+static const char* OrderedHashTableName(StringsStorage* names, Object* table) {
+  Table* t = Table::cast(table);
+  return names->GetFormatted("(ordered hash table %d of %d, %d deleted)",
+                             t->NumberOfElements(), t->Capacity(),
+                             t->NumberOfDeletedElements());
+}
+
+
 void V8HeapExplorer::ExtractJSCollectionReferences(int entry,
                                                    JSCollection* collection) {
-  SetInternalReference(collection, entry, "table", collection->table(),
+  Object* table = collection->table();
+  if (table->IsOrderedHashTable()) {
+    TagObject(table, collection->IsJSMap()
+                         ? OrderedHashTableName<OrderedHashMap>(names_, table)
+                         : OrderedHashTableName<OrderedHashSet>(names_, table));
+  }
+  SetInternalReference(collection, entry, "table", table,
                        JSCollection::kTableOffset);
 }
 
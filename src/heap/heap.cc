@@ -1008,6 +1008,11 @@ void Heap::ClearNormalizedMapCaches() {
     if (!cache->IsUndefined()) {
       NormalizedMapCache::cast(cache)->Clear();
     }
+    cache = Context::cast(context)->get(Context::REOPTIMIZED_MAP_CACHE_INDEX);
+    if (!cache->IsUndefined()) {
+      FixedArray* entries = FixedArray::cast(cache);
+      for (int i = 0; i < entries->length(); i++) entries->set_undefined(i);
+    }
     context = Context::cast(context)->get(Context::NEXT_CONTEXT_LINK);
   }
 }
@@ -2872,6 +2877,7 @@ void Heap::CreateInitialObjects() {
   set_nonexistent_symbol(*factory->NewPrivateSymbol());
   set_normal_ic_symbol(*factory->NewPrivateSymbol());
   set_observed_symbol(*factory->NewPrivateSymbol());
+  set_reoptimized_symbol(*factory->NewPrivateSymbol());
   set_stack_trace_symbol(*factory->NewPrivateSymbol());
   set_uninitialized_symbol(*factory->NewPrivateSymbol());
   set_home_object_symbol(*factory->NewPrivateOwnSymbol());
@@ -189,6 +189,7 @@ namespace internal {
   V(Symbol, detailed_stack_trace_symbol, DetailedStackTraceSymbol)             \
   V(Symbol, normal_ic_symbol, NormalICSymbol)                                  \
   V(Symbol, home_object_symbol, HomeObjectSymbol)                              \
+  V(Symbol, reoptimized_symbol, ReoptimizedSymbol)                             \
   V(FixedArray, materialized_objects, MaterializedObjects)                     \
   V(FixedArray, allocation_sites_scratchpad, AllocationSitesScratchpad)        \
   V(FixedArray, microtask_queue, MicrotaskQueue)
@@ -2255,7 +2256,7 @@ class KeyedLookupCache {
   // Clear the cache.
   void Clear();
 
-  static const int kLength = 256;
+  static const int kLength = 1024;
   static const int kCapacityMask = kLength - 1;
   static const int kMapHashShift = 5;
   static const int kHashMask = -4;  // Zero the last two bits.
@@ -38,6 +38,72 @@ bool HEscapeAnalysisPhase::HasNoEscapingUses(HValue* value, int size) {
 }
 
 
+// Adds to {maps} every map stored into the object {value}, either directly
+// or by a transitioning store, following redefinitions. Returns false if a
+// stored map is not a constant.
+bool HEscapeAnalysisPhase::CollectStoredMaps(HValue* value,
+                                             UniqueSet<Map>* maps) {
+  for (HUseIterator it(value->uses()); !it.Done(); it.Advance()) {
+    HValue* use = it.value();
+    if (use->IsStoreNamedField() && it.index() == 0) {
+      HStoreNamedField* store = HStoreNamedField::cast(use);
+      HValue* map = NULL;
+      if (store->access().IsMap()) {
+        map = store->value();
+      } else if (store->has_transition()) {
+        map = store->transition();
+      }
+      if (map != NULL) {
+        if (!map->IsConstant() || !HConstant::cast(map)->HasMapValue()) {
+          return false;
+        }
+        maps->Add(HConstant::cast(map)->MapValue(), zone());
+      }
+    }
+    int redefined_index = use->RedefinedOperandIndex();
+    if (redefined_index == it.index() && !CollectStoredMaps(use, maps)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+// Returns true if every polymorphic map check on the object {value} covers
+// all the maps in {stored_maps}. Such checks always pass. Others cannot be
+// expressed as a single check against the tracked map once the object is
+// captured, so they make the object escape.
+bool HEscapeAnalysisPhase::HasOnlyCoveringMapChecks(
+    HValue* value, UniqueSet<Map>* stored_maps) {
+  for (HUseIterator it(value->uses()); !it.Done(); it.Advance()) {
+    HValue* use = it.value();
+    if (use->IsCheckMaps() && it.index() == 0) {
+      HCheckMaps* mapcheck = HCheckMaps::cast(use);
+      if (mapcheck->maps()->size() > 1 &&
+          (stored_maps == NULL || !stored_maps->IsSubset(mapcheck->maps()))) {
+        if (FLAG_trace_escape_analysis) {
+          PrintF("#%d (%s) escapes through polymorphic #%d (%s)\n",
+                 value->id(), value->Mnemonic(), use->id(), use->Mnemonic());
+        }
+        return false;
+      }
+    }
+    int redefined_index = use->RedefinedOperandIndex();
+    if (redefined_index == it.index() &&
+        !HasOnlyCoveringMapChecks(use, stored_maps)) {
+      return false;
+    }
+  }
+  return true;
+}
+
+
+UniqueSet<Map>* HEscapeAnalysisPhase::ComputeStoredMaps(HValue* value) {
+  UniqueSet<Map>* maps = new(zone()) UniqueSet<Map>();
+  return CollectStoredMaps(value, maps) ? maps : NULL;
+}
+
+
 void HEscapeAnalysisPhase::CollectCapturedValues() {
   int block_count = graph()->blocks()->length();
   for (int i = 0; i < block_count; ++i) {
@@ -48,7 +114,8 @@ void HEscapeAnalysisPhase::CollectCapturedValues() {
       HAllocate* allocate = HAllocate::cast(instr);
       if (!allocate->size()->IsInteger32Constant()) continue;
       int size_in_bytes = allocate->size()->GetInteger32Constant();
-      if (HasNoEscapingUses(instr, size_in_bytes)) {
+      if (HasNoEscapingUses(instr, size_in_bytes) &&
+          HasOnlyCoveringMapChecks(instr, ComputeStoredMaps(instr))) {
         if (FLAG_trace_escape_analysis) {
           PrintF("#%d (%s) is being captured\n", instr->id(),
                  instr->Mnemonic());
@@ -124,13 +191,30 @@ HPhi* HEscapeAnalysisPhase::NewPhiAndInsert(HBasicBlock* block,
 }
 
 
+// Returns true if every map the captured object can have at the check is
+// contained in the set of maps being checked, so the check always passes.
+bool HEscapeAnalysisPhase::IsMapCheckRedundant(HCapturedObject* state,
+                                               HCheckMaps* mapcheck) {
+  HValue* value = state->map_value();
+  if (value->IsConstant()) {
+    HConstant* constant = HConstant::cast(value);
+    return constant->HasMapValue() &&
+           mapcheck->maps()->Contains(constant->MapValue());
+  }
+  // The tracked map merges several of the stored maps.
+  return stored_maps_ != NULL && stored_maps_->IsSubset(mapcheck->maps());
+}
+
+
 // Insert a newly created value check as a replacement for map checks.
 HValue* HEscapeAnalysisPhase::NewMapCheckAndInsert(HCapturedObject* state,
                                                    HCheckMaps* mapcheck) {
   Zone* zone = graph()->zone();
   HValue* value = state->map_value();
-  // TODO(mstarzinger): This will narrow a map check against a set of maps
-  // down to the first element in the set. Revisit and fix this.
+  // Polymorphic checks are only replaced if the tracked map is a constant,
+  // which either matches one of the maps or none. Otherwise they cover all
+  // stored maps and are redundant, see HasOnlyCoveringMapChecks.
+  DCHECK(mapcheck->maps()->size() == 1 || value->IsConstant());
   HCheckValue* check = HCheckValue::New(
       zone, NULL, value, mapcheck->maps()->at(0), false);
   check->InsertBefore(mapcheck);
@@ -138,6 +222,26 @@ HValue* HEscapeAnalysisPhase::NewMapCheckAndInsert(HCapturedObject* state,
 }
 
 
+// A captured object has no other references, so it can only be identical
+// to itself. Fix the outcome of the comparison and drop the uses of the
+// allocation; the branch is removed when unreachable blocks are marked.
+void HEscapeAnalysisPhase::FoldObjectComparison(
+    HInstruction* allocate,
+    HCompareObjectEqAndBranch* compare) {
+  bool identical = compare->left() == compare->right();
+  compare->set_known_successor_index(identical ? 0 : 1);
+  HConstant* undefined = graph()->GetConstantUndefined();
+  for (int i = 0; i < compare->OperandCount(); i++) {
+    if (compare->OperandAt(i) != allocate) continue;
+    compare->SetOperandAt(i, undefined);
+  }
+  if (FLAG_trace_escape_analysis) {
+    PrintF("Folding comparison #%d to %s\n", compare->id(),
+           identical ? "true" : "false");
+  }
+}
+
+
 // Replace a field load with a given value, forcing Smi representation if
 // necessary.
 HValue* HEscapeAnalysisPhase::NewLoadReplacement(
@@ -237,10 +341,21 @@ void HEscapeAnalysisPhase::AnalyzeDataFlow(HInstruction* allocate) {
         case HValue::kCheckMaps: {
           HCheckMaps* mapcheck = HCheckMaps::cast(instr);
           if (mapcheck->value() != allocate) continue;
-          NewMapCheckAndInsert(state, mapcheck);
+          if (!IsMapCheckRedundant(state, mapcheck)) {
+            NewMapCheckAndInsert(state, mapcheck);
+          }
           mapcheck->DeleteAndReplaceWith(mapcheck->ActualValue());
           break;
         }
+        case HValue::kCompareObjectEqAndBranch: {
+          HCompareObjectEqAndBranch* compare =
+              HCompareObjectEqAndBranch::cast(instr);
+          if (compare->left() != allocate && compare->right() != allocate) {
+            continue;
+          }
+          FoldObjectComparison(allocate, compare);
+          break;
+        }
         default:
           // Nothing to see here, move along ...
           break;
@@ -300,6 +415,7 @@ void HEscapeAnalysisPhase::PerformScalarReplacement() {
     number_of_values_ = size_in_bytes / kPointerSize;
     number_of_objects_++;
     block_states_.Rewind(0);
+    stored_maps_ = ComputeStoredMaps(allocate);
 
     // Perform actual analysis step.
     AnalyzeDataFlow(allocate);
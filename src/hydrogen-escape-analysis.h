@@ -20,6 +20,7 @@ class HEscapeAnalysisPhase : public HPhase {
         number_of_objects_(0),
         number_of_values_(0),
         cumulative_values_(0),
+        stored_maps_(NULL),
         block_states_(graph->blocks()->length(), zone()) { }
 
   void Run();
@@ -27,6 +28,9 @@ class HEscapeAnalysisPhase : public HPhase {
  private:
   void CollectCapturedValues();
   bool HasNoEscapingUses(HValue* value, int size);
+  bool CollectStoredMaps(HValue* value, UniqueSet<Map>* maps);
+  UniqueSet<Map>* ComputeStoredMaps(HValue* value);
+  bool HasOnlyCoveringMapChecks(HValue* value, UniqueSet<Map>* stored_maps);
   void PerformScalarReplacement();
   void AnalyzeDataFlow(HInstruction* instr);
 
@@ -37,8 +41,12 @@ class HEscapeAnalysisPhase : public HPhase {
 
   HPhi* NewPhiAndInsert(HBasicBlock* block, HValue* incoming_value, int index);
 
+  bool IsMapCheckRedundant(HCapturedObject* state, HCheckMaps* mapcheck);
   HValue* NewMapCheckAndInsert(HCapturedObject* state, HCheckMaps* mapcheck);
 
+  void FoldObjectComparison(HInstruction* allocate,
+                            HCompareObjectEqAndBranch* compare);
+
   HValue* NewLoadReplacement(HLoadNamedField* load, HValue* load_value);
 
   HCapturedObject* StateAt(HBasicBlock* block) {
@@ -59,6 +67,10 @@ class HEscapeAnalysisPhase : public HPhase {
   int number_of_values_;
   int cumulative_values_;
 
+  // Maps stored into the object being replaced, or NULL if some of them are
+  // not constant.
+  UniqueSet<Map>* stored_maps_;
+
   // Map of block IDs to the data-flow state at block entry during the
   // scalar replacement phase.
   ZoneList<HCapturedObject*> block_states_;
@@ -2347,6 +2347,21 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
                             ElementsKind kind,
                             ArrayIndexOfMode mode);
 
+  // Returns the hash of |object| if it is a string whose hash has already
+  // been computed, and captures the outcome of that check.
+  HValue* BuildStringHashLoadIfIsStringAndHashComputed(
+      HValue* object, HIfContinuation* continuation);
+
+  // Returns the index of the key of the entry for |key| in |table|, or
+  // CollectionType::kNotFound. Only string keys are supported.
+  template <typename CollectionType>
+  HValue* BuildOrderedHashTableFindEntry(HValue* table, HValue* key,
+                                         HValue* hash);
+
+  template <typename CollectionType>
+  void BuildJSCollectionHas(CallRuntime* call,
+                            const Runtime::Function* c_function);
+
   HValue* ImplicitReceiverFor(HValue* function,
                               Handle<JSFunction> target);
 
@@ -2768,6 +2783,8 @@ class HOptimizedGraphBuilder : public HGraphBuilder, public AstVisitor {
 Zone* AstContext::zone() const { return owner_->zone(); }
 
 
+// Phases may be recorded from several concurrent recompilation threads, so
+// all updates are guarded by a mutex.
 class HStatistics FINAL: public Malloced {
  public:
   HStatistics()
@@ -2782,26 +2799,36 @@ class HStatistics FINAL: public Malloced {
   void SaveTiming(const char* name, base::TimeDelta time, unsigned size);
 
   void IncrementFullCodeGen(base::TimeDelta full_code_gen) {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
     full_code_gen_ += full_code_gen;
   }
 
-  void IncrementCreateGraph(base::TimeDelta delta) { create_graph_ += delta; }
+  void IncrementCreateGraph(base::TimeDelta delta) {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    create_graph_ += delta;
+  }
 
   void IncrementOptimizeGraph(base::TimeDelta delta) {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
     optimize_graph_ += delta;
   }
 
-  void IncrementGenerateCode(base::TimeDelta delta) { generate_code_ += delta; }
+  void IncrementGenerateCode(base::TimeDelta delta) {
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    generate_code_ += delta;
+  }
 
   void IncrementSubtotals(base::TimeDelta create_graph,
                           base::TimeDelta optimize_graph,
                           base::TimeDelta generate_code) {
-    IncrementCreateGraph(create_graph);
-    IncrementOptimizeGraph(optimize_graph);
-    IncrementGenerateCode(generate_code);
+    base::LockGuard<base::Mutex> lock_guard(&mutex_);
+    create_graph_ += create_graph;
+    optimize_graph_ += optimize_graph;
+    generate_code_ += generate_code;
   }
 
  private:
+  base::Mutex mutex_;
   List<base::TimeDelta> times_;
   List<const char*> names_;
   List<unsigned> sizes_;
@@ -851,6 +851,43 @@ static void KeyedStoreGenerateGenericHelper(
 }
 
 
+// Stores to an existing, writable data property of a receiver with dictionary
+// properties. Objects that are used as hash maps end up in dictionary mode, so
+// this keeps obj[name] = value out of the runtime for them. Everything else,
+// including stores that would add a property, jumps to slow.
+static void KeyedStoreGenerateDictionaryStore(MacroAssembler* masm,
+                                              Register receiver_map,
+                                              Label* slow) {
+  Register receiver = StoreDescriptor::ReceiverRegister();
+  Register key = StoreDescriptor::NameRegister();
+  Register value = StoreDescriptor::ValueRegister();
+  Register dictionary = r3;
+  DCHECK(receiver_map.is(r3));
+
+  // The receiver must be a non-global JSObject without a named interceptor.
+  __ ldrb(r4, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
+  __ cmp(r4, Operand(FIRST_JS_OBJECT_TYPE));
+  __ b(lt, slow);
+  GenerateGlobalInstanceTypeCheck(masm, r4, slow);
+  __ ldrb(ip, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
+  __ tst(ip, Operand(1 << Map::kHasNamedInterceptor));
+  __ b(ne, slow);
+
+  // The key must be a unique name that is not an array index.
+  GenerateKeyNameCheck(masm, key, r4, r5, slow, slow);
+
+  __ ldr(dictionary, FieldMemOperand(receiver, JSObject::kPropertiesOffset));
+  __ ldr(r4, FieldMemOperand(dictionary, HeapObject::kMapOffset));
+  __ LoadRoot(ip, Heap::kHashTableMapRootIndex);
+  __ cmp(r4, ip);
+  __ b(ne, slow);
+  GenerateDictionaryStore(masm, slow, dictionary, key, value, r4, r5);
+  Counters* counters = masm->isolate()->counters();
+  __ IncrementCounter(counters->keyed_store_generic_dictionary(), 1, r4, r5);
+  __ Ret();
+}
+
+
 void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                    StrictMode strict_mode) {
   // ---------- S t a t e --------------
@@ -861,7 +898,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   // -----------------------------------
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
-  Label array, extra, check_if_double_array;
+  Label array, extra, check_if_double_array, maybe_name_key;
 
   // Register usage.
   Register value = StoreDescriptor::ValueRegister();
@@ -875,8 +912,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = r9;  // Elements array of the receiver.
   // r4 and r5 are used as general scratch registers.
 
-  // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow);
   // Check that the object isn't a smi.
   __ JumpIfSmi(receiver, &slow);
   // Get the map of the object.
@@ -886,6 +921,8 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ ldrb(ip, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
   __ tst(ip, Operand(1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved));
   __ b(ne, &slow);
+  // Check that the key is a smi.
+  __ JumpIfNotSmi(key, &maybe_name_key);
   // Check if the object is a JS array or not.
   __ ldrb(r4, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
   __ cmp(r4, Operand(JS_ARRAY_TYPE));
@@ -909,6 +946,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   // r2: receiver.
   PropertyICCompiler::GenerateRuntimeSetProperty(masm, strict_mode);
 
+  __ bind(&maybe_name_key);
+  KeyedStoreGenerateDictionaryStore(masm, receiver_map, &slow);
+
   // Extra capacity case: Check if there is extra capacity to
   // perform the store and update the length. Used for adding one
   // element to the array by writing to array[array.length].
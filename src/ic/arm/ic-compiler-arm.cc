@@ -88,6 +88,32 @@ Handle<Code> PropertyICCompiler::CompilePolymorphic(TypeHandleList* types,
 }
 
 
+Handle<Code> PropertyICCompiler::CompileShapeFamily(Handle<Cell> descriptors,
+                                                    int min_own_descriptors,
+                                                    Handle<Code> handler,
+                                                    Handle<Name> name) {
+  Label miss;
+  __ JumpIfSmi(receiver(), &miss);
+
+  Register map_reg = scratch1();
+  Register scratch = scratch2();
+  __ ldr(map_reg, FieldMemOperand(receiver(), HeapObject::kMapOffset));
+  __ NumberOfOwnDescriptors(scratch, map_reg);
+  __ cmp(scratch, Operand(min_own_descriptors));
+  __ b(lt, &miss);
+  __ LoadInstanceDescriptors(map_reg, map_reg);
+  __ mov(scratch, Operand(descriptors));
+  __ ldr(scratch, FieldMemOperand(scratch, Cell::kValueOffset));
+  __ cmp(map_reg, scratch);
+  __ Jump(handler, RelocInfo::CODE_TARGET, eq);
+
+  __ bind(&miss);
+  TailCallBuiltin(masm(), MissBuiltin(kind()));
+
+  return GetCode(kind(), Code::NORMAL, name, POLYMORPHIC);
+}
+
+
 Handle<Code> PropertyICCompiler::CompileKeyedStorePolymorphic(
     MapHandleList* receiver_maps, CodeHandleList* handler_stubs,
     MapHandleList* transitioned_maps) {
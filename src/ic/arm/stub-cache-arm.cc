@@ -97,6 +97,8 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
                               Register scratch, Register extra, Register extra2,
                               Register extra3) {
   Isolate* isolate = masm->isolate();
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
   Label miss;
 
   // Make sure that code is valid. The multiplying code relies on the
@@ -134,25 +136,32 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
   __ ldr(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ ldr(ip, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ add(scratch, scratch, Operand(ip));
-  uint32_t mask = kPrimaryTableSize - 1;
   // We shift out the last two bits because they are not part of the hash and
   // they are always 01 for maps.
   __ mov(scratch, Operand(scratch, LSR, kCacheIndexShift));
-  // Mask down the eor argument to the minimum to keep the immediate
-  // ARM-encodable.
-  __ eor(scratch, scratch, Operand((flags >> kCacheIndexShift) & mask));
-  // Prefer and_ to ubfx here because ubfx takes 2 cycles.
-  __ and_(scratch, scratch, Operand(mask));
+  // Mask down the eor argument to keep the immediate ARM-encodable.
+  __ eor(scratch, scratch,
+         Operand((flags >> kCacheIndexShift) & kMaxTableMask));
+  // The masks are loaded since the table sizes are set per isolate. They are
+  // scaled by 1 << kCacheIndexShift.
+  __ mov(ip, Operand(primary_mask));
+  __ ldr(ip, MemOperand(ip));
+  __ and_(scratch, scratch, Operand(ip, LSR, kCacheIndexShift));
 
   // Probe the primary table.
   ProbeTable(isolate, masm, flags, kPrimary, receiver, name, scratch, extra,
              extra2, extra3);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1,
+                      extra2, extra3);
+
   // Primary miss: Compute hash for secondary probe.
   __ sub(scratch, scratch, Operand(name, LSR, kCacheIndexShift));
-  uint32_t mask2 = kSecondaryTableSize - 1;
-  __ add(scratch, scratch, Operand((flags >> kCacheIndexShift) & mask2));
-  __ and_(scratch, scratch, Operand(mask2));
+  __ add(scratch, scratch,
+         Operand((flags >> kCacheIndexShift) & kMaxTableMask));
+  __ mov(ip, Operand(secondary_mask));
+  __ ldr(ip, MemOperand(ip));
+  __ and_(scratch, scratch, Operand(ip, LSR, kCacheIndexShift));
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, flags, kSecondary, receiver, name, scratch, extra,
@@ -885,6 +885,41 @@ static void KeyedStoreGenerateGenericHelper(
 }
 
 
+// Stores to an existing, writable data property of a receiver with dictionary
+// properties. Objects that are used as hash maps end up in dictionary mode, so
+// this keeps obj[name] = value out of the runtime for them. Everything else,
+// including stores that would add a property, jumps to slow.
+static void KeyedStoreGenerateDictionaryStore(MacroAssembler* masm,
+                                              Register receiver_map,
+                                              Label* slow) {
+  Register receiver = StoreDescriptor::ReceiverRegister();
+  Register key = StoreDescriptor::NameRegister();
+  Register value = StoreDescriptor::ValueRegister();
+  Register dictionary = x3;
+  DCHECK(receiver_map.is(x3));
+  DCHECK(!AreAliased(value, receiver, key, x3, x4, x5));
+
+  // The receiver must be a non-global JSObject without a named interceptor.
+  __ Ldrb(x10, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
+  __ Cmp(x10, FIRST_JS_OBJECT_TYPE);
+  __ B(lt, slow);
+  GenerateGlobalInstanceTypeCheck(masm, x10, slow);
+  __ Ldrb(x10, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
+  __ TestAndBranchIfAnySet(x10, 1 << Map::kHasNamedInterceptor, slow);
+
+  // The key must be a unique name that is not an array index.
+  GenerateKeyNameCheck(masm, key, x4, x5, slow, slow);
+
+  __ Ldr(dictionary, FieldMemOperand(receiver, JSObject::kPropertiesOffset));
+  __ Ldr(x4, FieldMemOperand(dictionary, HeapObject::kMapOffset));
+  __ JumpIfNotRoot(x4, Heap::kHashTableMapRootIndex, slow);
+  GenerateDictionaryStore(masm, slow, dictionary, key, value, x4, x5);
+  Counters* counters = masm->isolate()->counters();
+  __ IncrementCounter(counters->keyed_store_generic_dictionary(), 1, x4, x5);
+  __ Ret();
+}
+
+
 void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                    StrictMode strict_mode) {
   ASM_LOCATION("KeyedStoreIC::GenerateGeneric");
@@ -895,6 +930,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Label fast_object_grow;
   Label fast_double_grow;
   Label fast_double;
+  Label maybe_name_key;
 
   Register value = StoreDescriptor::ValueRegister();
   Register key = StoreDescriptor::NameRegister();
@@ -907,7 +943,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = x4;
   Register elements_map = x5;
 
-  __ JumpIfNotSmi(key, &slow);
   __ JumpIfSmi(receiver, &slow);
   __ Ldr(receiver_map, FieldMemOperand(receiver, HeapObject::kMapOffset));
 
@@ -916,6 +951,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ Ldrb(x10, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
   __ TestAndBranchIfAnySet(
       x10, (1 << Map::kIsAccessCheckNeeded) | (1 << Map::kIsObserved), &slow);
+  __ JumpIfNotSmi(key, &maybe_name_key);
 
   // Check if the object is a JS array or not.
   Register instance_type = x10;
@@ -941,6 +977,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   //  x2: receiver
   PropertyICCompiler::GenerateRuntimeSetProperty(masm, strict_mode);
 
+  __ Bind(&maybe_name_key);
+  KeyedStoreGenerateDictionaryStore(masm, receiver_map, &slow);
+
 
   __ Bind(&extra);
   // Extra capacity case: Check if there is extra capacity to
@@ -89,6 +89,33 @@ Handle<Code> PropertyICCompiler::CompilePolymorphic(TypeHandleList* types,
 }
 
 
+Handle<Code> PropertyICCompiler::CompileShapeFamily(Handle<Cell> descriptors,
+                                                    int min_own_descriptors,
+                                                    Handle<Code> handler,
+                                                    Handle<Name> name) {
+  Label miss;
+  __ JumpIfSmi(receiver(), &miss);
+
+  Register map_reg = scratch1();
+  Register scratch = scratch2();
+  __ Ldr(map_reg, FieldMemOperand(receiver(), HeapObject::kMapOffset));
+  __ NumberOfOwnDescriptors(scratch, map_reg);
+  __ Cmp(scratch, min_own_descriptors);
+  __ B(lt, &miss);
+  __ LoadInstanceDescriptors(map_reg, map_reg);
+  __ Mov(scratch, Operand(descriptors));
+  __ Ldr(scratch, FieldMemOperand(scratch, Cell::kValueOffset));
+  __ Cmp(map_reg, scratch);
+  __ B(ne, &miss);
+  __ Jump(handler, RelocInfo::CODE_TARGET);
+
+  __ Bind(&miss);
+  TailCallBuiltin(masm(), MissBuiltin(kind()));
+
+  return GetCode(kind(), Code::NORMAL, name, POLYMORPHIC);
+}
+
+
 Handle<Code> PropertyICCompiler::CompileKeyedStorePolymorphic(
     MapHandleList* receiver_maps, CodeHandleList* handler_stubs,
     MapHandleList* transitioned_maps) {
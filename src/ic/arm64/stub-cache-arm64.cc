@@ -92,6 +92,8 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
                               Register scratch, Register extra, Register extra2,
                               Register extra3) {
   Isolate* isolate = masm->isolate();
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
   Label miss;
 
   // Make sure the flags does not name a specific type.
@@ -117,18 +119,27 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
   __ Ldr(extra, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ Add(scratch, scratch, extra);
   __ Eor(scratch, scratch, flags);
-  // We shift out the last two bits because they are not part of the hash.
-  __ Ubfx(scratch, scratch, kCacheIndexShift,
-          CountTrailingZeros(kPrimaryTableSize, 64));
+  // The masks are loaded since the table sizes are set per isolate. They are
+  // scaled by 1 << kCacheIndexShift, so the result is shifted down after
+  // masking; the last two bits are not part of the hash.
+  __ Mov(extra, primary_mask);
+  __ Ldr(extra, MemOperand(extra));
+  __ And(scratch, scratch, extra);
+  __ Lsr(scratch, scratch, kCacheIndexShift);
 
   // Probe the primary table.
   ProbeTable(isolate, masm, flags, kPrimary, receiver, name, scratch, extra,
              extra2, extra3);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1,
+                      extra2, extra3);
+
   // Primary miss: Compute hash for secondary table.
   __ Sub(scratch, scratch, Operand(name, LSR, kCacheIndexShift));
   __ Add(scratch, scratch, flags >> kCacheIndexShift);
-  __ And(scratch, scratch, kSecondaryTableSize - 1);
+  __ Mov(extra, secondary_mask);
+  __ Ldr(extra, MemOperand(extra));
+  __ And(scratch, scratch, Operand(extra, LSR, kCacheIndexShift));
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, flags, kSecondary, receiver, name, scratch, extra,
@@ -68,6 +68,30 @@ Handle<Code> NamedLoadHandlerCompiler::ComputeLoadNonexistent(
 }
 
 
+Handle<Code> NamedLoadHandlerCompiler::ComputeLoadOwnCallback(
+    Handle<Name> name, Handle<HeapType> type, Handle<JSObject> holder,
+    Handle<ExecutableAccessorInfo> callback, CacheHolderFlag cache_holder) {
+  Isolate* isolate = name->GetIsolate();
+  // When the receiver is the holder the handler does no map checks and only
+  // embeds |callback|. API accessor infos come from templates, which outlive
+  // native contexts, so caching the handler on the info lets every context
+  // that instantiates the same template reuse it instead of compiling its
+  // own copy for its own maps.
+  bool shareable = FLAG_share_api_load_handlers &&
+                   cache_holder == kCacheOnReceiver &&
+                   !isolate->serializer_enabled();
+  if (shareable && callback->load_handler()->IsCode()) {
+    isolate->counters()->load_callback_handler_reused()->Increment();
+    return handle(Code::cast(callback->load_handler()), isolate);
+  }
+
+  NamedLoadHandlerCompiler compiler(isolate, type, holder, cache_holder);
+  Handle<Code> handler = compiler.CompileLoadCallback(name, callback);
+  if (shareable) callback->set_load_handler(*handler);
+  return handler;
+}
+
+
 Handle<Code> PropertyHandlerCompiler::GetCode(Code::Kind kind,
                                               Code::StubType type,
                                               Handle<Name> name) {
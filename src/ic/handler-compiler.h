@@ -133,6 +133,10 @@ class NamedLoadHandlerCompiler : public PropertyHandlerCompiler {
   static Handle<Code> ComputeLoadNonexistent(Handle<Name> name,
                                              Handle<HeapType> type);
 
+  static Handle<Code> ComputeLoadOwnCallback(
+      Handle<Name> name, Handle<HeapType> type, Handle<JSObject> holder,
+      Handle<ExecutableAccessorInfo> callback, CacheHolderFlag cache_holder);
+
   static void GenerateLoadViaGetter(MacroAssembler* masm, Handle<HeapType> type,
                                     Register receiver,
                                     Handle<JSFunction> getter);
@@ -278,6 +278,21 @@ Handle<Code> PropertyICCompiler::ComputePolymorphic(
 }
 
 
+Handle<Code> PropertyICCompiler::ComputeShapeFamily(
+    Code::Kind kind, Handle<Name> name, Handle<DescriptorArray> descriptors,
+    int min_own_descriptors, Handle<Code> handler,
+    ExtraICState extra_ic_state) {
+  DCHECK(kind == Code::LOAD_IC);
+  Isolate* isolate = name->GetIsolate();
+  // Descriptor arrays may be in new space, so the stub reaches the array
+  // through a cell instead of embedding it.
+  Handle<Cell> cell = isolate->factory()->NewCell(descriptors);
+  PropertyICCompiler ic_compiler(isolate, kind, extra_ic_state);
+  return ic_compiler.CompileShapeFamily(cell, min_own_descriptors, handler,
+                                        name);
+}
+
+
 Handle<Code> PropertyICCompiler::ComputeKeyedStorePolymorphic(
     MapHandleList* receiver_maps, KeyedAccessStoreMode store_mode,
     StrictMode strict_mode) {
@@ -35,6 +35,11 @@ class PropertyICCompiler : public PropertyAccessCompiler {
                                          int number_of_valid_maps,
                                          Handle<Name> name,
                                          ExtraICState extra_ic_state);
+  static Handle<Code> ComputeShapeFamily(Code::Kind kind, Handle<Name> name,
+                                         Handle<DescriptorArray> descriptors,
+                                         int min_own_descriptors,
+                                         Handle<Code> handler,
+                                         ExtraICState extra_ic_state);
 
   // Keyed
   static Handle<Code> ComputeKeyedLoadMonomorphic(Handle<Map> receiver_map);
@@ -83,6 +88,12 @@ class PropertyICCompiler : public PropertyAccessCompiler {
   Handle<Code> CompilePolymorphic(TypeHandleList* types,
                                   CodeHandleList* handlers, Handle<Name> name,
                                   Code::StubType type, IcCheckType check);
+  // Dispatches to |handler| for every receiver whose map uses the descriptor
+  // array held by |descriptors| and owns at least |min_own_descriptors| of its
+  // entries.
+  Handle<Code> CompileShapeFamily(Handle<Cell> descriptors,
+                                  int min_own_descriptors, Handle<Code> handler,
+                                  Handle<Name> name);
 
   Handle<Code> CompileKeyedStoreMonomorphic(Handle<Map> receiver_map,
                                             KeyedAccessStoreMode store_mode);
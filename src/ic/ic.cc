@@ -604,6 +604,16 @@ MaybeHandle<Object> LoadIC::Load(Handle<Object> object, Handle<Name> name) {
 
   bool use_ic = MigrateDeprecated(object) ? false : FLAG_use_ic;
 
+  // Loads from dictionary mode objects only get here on IC misses, so this
+  // counts how many sites read the object while its shape is stable. The
+  // receiver type of this IC is stale if the object was migrated.
+  if (object->IsJSObject() &&
+      !Handle<JSObject>::cast(object)->HasFastProperties()) {
+    Handle<JSObject> receiver = Handle<JSObject>::cast(object);
+    JSObject::RecordDictionaryLoad(receiver);
+    if (receiver->HasFastProperties()) use_ic = false;
+  }
+
   // Named lookup in the object.
   LookupIterator it(object, name);
   LookupForRead(&it);
@@ -675,7 +685,9 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name, Handle<Code> code) {
   int number_of_valid_types =
       number_of_types - deprecated_types - (handler_to_overwrite != -1);
 
-  if (number_of_valid_types >= 4) return false;
+  if (number_of_valid_types >= FLAG_max_polymorphism) {
+    return UpdateShapeFamilyIC(name, code, &types);
+  }
   if (number_of_types == 0) return false;
   if (!target()->FindHandlers(&handlers, types.length())) return false;
 
@@ -704,6 +716,44 @@ bool IC::UpdatePolymorphicIC(Handle<Name> name, Handle<Code> code) {
 }
 
 
+// A load IC that has seen too many maps to stay polymorphic can still avoid
+// going megamorphic if all of its maps are on one branch of the transition
+// tree. Such maps share a single descriptor array, so the accessed field has
+// the same descriptor and the same field handler in all of them. Checking the
+// descriptor array and the number of own descriptors of the receiver map then
+// covers the whole family, including maps the IC has not seen yet.
+bool IC::UpdateShapeFamilyIC(Handle<Name> name, Handle<Code> code,
+                             TypeHandleList* types) {
+  if (!FLAG_shape_family_ics || kind() != Code::LOAD_IC) return false;
+  if (!name->IsUniqueName()) return false;
+  if (CodeStub::GetMajorKey(*code) != CodeStub::LoadField) return false;
+  Handle<HeapType> type = receiver_type();
+  if (!type->IsClass()) return false;
+
+  Handle<Map> map = type->AsClass()->Map();
+  Handle<DescriptorArray> descriptors(map->instance_descriptors(), isolate());
+  int descriptor = descriptors->Search(*name, map->NumberOfOwnDescriptors());
+  if (descriptor == DescriptorArray::kNotFound) return false;
+  if (descriptors->GetDetails(descriptor).type() != FIELD) return false;
+
+  CodeHandleList handlers;
+  if (!target()->FindHandlers(&handlers, types->length())) return false;
+  for (int i = 0; i < types->length(); i++) {
+    Handle<HeapType> current_type = types->at(i);
+    if (!current_type->IsClass()) return false;
+    Map* current_map = *current_type->AsClass()->Map();
+    if (current_map->is_deprecated()) continue;
+    if (current_map->instance_descriptors() != *descriptors) return false;
+    if (!handlers.at(i).is_identical_to(code)) return false;
+  }
+
+  Handle<Code> ic = PropertyICCompiler::ComputeShapeFamily(
+      kind(), name, descriptors, descriptor + 1, code, extra_ic_state());
+  set_target(*ic);
+  return true;
+}
+
+
 Handle<HeapType> IC::CurrentTypeOf(Handle<Object> object, Isolate* isolate) {
   return object->IsJSGlobalObject()
              ? HeapType::Constant(Handle<JSGlobalObject>::cast(object), isolate)
@@ -1000,6 +1050,10 @@ Handle<Code> LoadIC::CompileHandler(LookupIterator* lookup,
           break;
         }
         if (!holder->HasFastProperties()) break;
+        if (receiver_is_holder && kind() == Code::LOAD_IC) {
+          return NamedLoadHandlerCompiler::ComputeLoadOwnCallback(
+              lookup->name(), receiver_type(), holder, info, cache_holder);
+        }
         NamedLoadHandlerCompiler compiler(isolate(), receiver_type(), holder,
                                           cache_holder);
         return compiler.CompileLoadCallback(lookup->name(), info);
@@ -179,6 +179,8 @@ class IC {
 
   void UpdateMonomorphicIC(Handle<Code> handler, Handle<Name> name);
   bool UpdatePolymorphicIC(Handle<Name> name, Handle<Code> code);
+  bool UpdateShapeFamilyIC(Handle<Name> name, Handle<Code> code,
+                           TypeHandleList* types);
   void UpdateMegamorphicCache(HeapType* type, Name* name, Code* code);
 
   void CopyICToMegamorphicCache(Handle<Name> name);
@@ -73,6 +73,30 @@ Handle<Code> PropertyICCompiler::CompilePolymorphic(TypeHandleList* types,
 }
 
 
+Handle<Code> PropertyICCompiler::CompileShapeFamily(Handle<Cell> descriptors,
+                                                    int min_own_descriptors,
+                                                    Handle<Code> handler,
+                                                    Handle<Name> name) {
+  Label miss;
+  __ JumpIfSmi(receiver(), &miss);
+
+  Register map_reg = scratch1();
+  Register scratch = scratch2();
+  __ lw(map_reg, FieldMemOperand(receiver(), HeapObject::kMapOffset));
+  __ NumberOfOwnDescriptors(scratch, map_reg);
+  __ Branch(&miss, lt, scratch, Operand(min_own_descriptors));
+  __ LoadInstanceDescriptors(map_reg, map_reg);
+  __ li(scratch, Operand(descriptors));
+  __ lw(scratch, FieldMemOperand(scratch, Cell::kValueOffset));
+  __ Jump(handler, RelocInfo::CODE_TARGET, eq, map_reg, Operand(scratch));
+
+  __ bind(&miss);
+  TailCallBuiltin(masm(), MissBuiltin(kind()));
+
+  return GetCode(kind(), Code::NORMAL, name, POLYMORPHIC);
+}
+
+
 Handle<Code> PropertyICCompiler::CompileKeyedStorePolymorphic(
     MapHandleList* receiver_maps, CodeHandleList* handler_stubs,
     MapHandleList* transitioned_maps) {
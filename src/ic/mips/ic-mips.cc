@@ -810,6 +810,41 @@ static void KeyedStoreGenerateGenericHelper(
 }
 
 
+// Stores to an existing, writable data property of a receiver with dictionary
+// properties. Objects that are used as hash maps end up in dictionary mode, so
+// this keeps obj[name] = value out of the runtime for them. Everything else,
+// including stores that would add a property, jumps to slow.
+static void KeyedStoreGenerateDictionaryStore(MacroAssembler* masm,
+                                              Register receiver_map,
+                                              Label* slow) {
+  Register receiver = StoreDescriptor::ReceiverRegister();
+  Register key = StoreDescriptor::NameRegister();
+  Register value = StoreDescriptor::ValueRegister();
+  Register dictionary = a3;
+  DCHECK(receiver_map.is(a3));
+
+  // The receiver must be a non-global JSObject without a named interceptor.
+  __ lbu(t0, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
+  __ Branch(slow, lt, t0, Operand(FIRST_JS_OBJECT_TYPE));
+  GenerateGlobalInstanceTypeCheck(masm, t0, slow);
+  __ lbu(t0, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
+  __ And(t0, t0, Operand(1 << Map::kHasNamedInterceptor));
+  __ Branch(slow, ne, t0, Operand(zero_reg));
+
+  // The key must be a unique name that is not an array index.
+  GenerateKeyNameCheck(masm, key, t0, t1, slow, slow);
+
+  __ lw(dictionary, FieldMemOperand(receiver, JSObject::kPropertiesOffset));
+  __ lw(t0, FieldMemOperand(dictionary, HeapObject::kMapOffset));
+  __ LoadRoot(at, Heap::kHashTableMapRootIndex);
+  __ Branch(slow, ne, t0, Operand(at));
+  GenerateDictionaryStore(masm, slow, dictionary, key, value, t0, t1);
+  Counters* counters = masm->isolate()->counters();
+  __ IncrementCounter(counters->keyed_store_generic_dictionary(), 1, t0, t1);
+  __ Ret();
+}
+
+
 void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                    StrictMode strict_mode) {
   // ---------- S t a t e --------------
@@ -820,7 +855,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   // -----------------------------------
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
-  Label array, extra, check_if_double_array;
+  Label array, extra, check_if_double_array, maybe_name_key;
 
   // Register usage.
   Register value = StoreDescriptor::ValueRegister();
@@ -832,8 +867,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = t3;  // Elements array of the receiver.
   // t0 and t1 are used as general scratch registers.
 
-  // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow);
   // Check that the object isn't a smi.
   __ JumpIfSmi(receiver, &slow);
   // Get the map of the object.
@@ -844,6 +877,8 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ And(t0, t0,
          Operand(1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved));
   __ Branch(&slow, ne, t0, Operand(zero_reg));
+  // Check that the key is a smi.
+  __ JumpIfNotSmi(key, &maybe_name_key);
   // Check if the object is a JS array or not.
   __ lbu(t0, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
   __ Branch(&array, eq, t0, Operand(JS_ARRAY_TYPE));
@@ -864,6 +899,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   // a2: receiver.
   PropertyICCompiler::GenerateRuntimeSetProperty(masm, strict_mode);
 
+  __ bind(&maybe_name_key);
+  KeyedStoreGenerateDictionaryStore(masm, receiver_map, &slow);
+
   // Extra capacity case: Check if there is extra capacity to
   // perform the store and update the length. Used for adding one
   // element to the array by writing to array[array.length].
@@ -93,6 +93,8 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
                               Register scratch, Register extra, Register extra2,
                               Register extra3) {
   Isolate* isolate = masm->isolate();
+  ExternalReference primary_mask(mask_reference(kPrimary));
+  ExternalReference secondary_mask(mask_reference(kSecondary));
   Label miss;
 
   // Make sure that code is valid. The multiplying code relies on the
@@ -130,23 +132,34 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
   __ lw(scratch, FieldMemOperand(name, Name::kHashFieldOffset));
   __ lw(at, FieldMemOperand(receiver, HeapObject::kMapOffset));
   __ Addu(scratch, scratch, at);
-  uint32_t mask = kPrimaryTableSize - 1;
   // We shift out the last two bits because they are not part of the hash and
   // they are always 01 for maps.
   __ srl(scratch, scratch, kCacheIndexShift);
-  __ Xor(scratch, scratch, Operand((flags >> kCacheIndexShift) & mask));
-  __ And(scratch, scratch, Operand(mask));
+  __ Xor(scratch, scratch,
+         Operand((flags >> kCacheIndexShift) & kMaxTableMask));
+  // The masks are loaded since the table sizes are set per isolate. They are
+  // scaled by 1 << kCacheIndexShift.
+  __ li(at, Operand(primary_mask));
+  __ lw(at, MemOperand(at));
+  __ srl(at, at, kCacheIndexShift);
+  __ And(scratch, scratch, Operand(at));
 
   // Probe the primary table.
   ProbeTable(isolate, masm, flags, kPrimary, receiver, name, scratch, extra,
              extra2, extra3);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1,
+                      extra2, extra3);
+
   // Primary miss: Compute hash for secondary probe.
   __ srl(at, name, kCacheIndexShift);
   __ Subu(scratch, scratch, at);
-  uint32_t mask2 = kSecondaryTableSize - 1;
-  __ Addu(scratch, scratch, Operand((flags >> kCacheIndexShift) & mask2));
-  __ And(scratch, scratch, Operand(mask2));
+  __ Addu(scratch, scratch,
+          Operand((flags >> kCacheIndexShift) & kMaxTableMask));
+  __ li(at, Operand(secondary_mask));
+  __ lw(at, MemOperand(at));
+  __ srl(at, at, kCacheIndexShift);
+  __ And(scratch, scratch, Operand(at));
 
   // Probe the secondary table.
   ProbeTable(isolate, masm, flags, kSecondary, receiver, name, scratch, extra,
@@ -819,6 +819,41 @@ static void KeyedStoreGenerateGenericHelper(
 }
 
 
+// Stores to an existing, writable data property of a receiver with dictionary
+// properties. Objects that are used as hash maps end up in dictionary mode, so
+// this keeps obj[name] = value out of the runtime for them. Everything else,
+// including stores that would add a property, jumps to slow.
+static void KeyedStoreGenerateDictionaryStore(MacroAssembler* masm,
+                                              Register receiver_map,
+                                              Label* slow) {
+  Register receiver = StoreDescriptor::ReceiverRegister();
+  Register key = StoreDescriptor::NameRegister();
+  Register value = StoreDescriptor::ValueRegister();
+  Register dictionary = a3;
+  DCHECK(receiver_map.is(a3));
+
+  // The receiver must be a non-global JSObject without a named interceptor.
+  __ lbu(a4, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
+  __ Branch(slow, lt, a4, Operand(FIRST_JS_OBJECT_TYPE));
+  GenerateGlobalInstanceTypeCheck(masm, a4, slow);
+  __ lbu(a4, FieldMemOperand(receiver_map, Map::kBitFieldOffset));
+  __ And(a4, a4, Operand(1 << Map::kHasNamedInterceptor));
+  __ Branch(slow, ne, a4, Operand(zero_reg));
+
+  // The key must be a unique name that is not an array index.
+  GenerateKeyNameCheck(masm, key, a4, a5, slow, slow);
+
+  __ ld(dictionary, FieldMemOperand(receiver, JSObject::kPropertiesOffset));
+  __ ld(a4, FieldMemOperand(dictionary, HeapObject::kMapOffset));
+  __ LoadRoot(at, Heap::kHashTableMapRootIndex);
+  __ Branch(slow, ne, a4, Operand(at));
+  GenerateDictionaryStore(masm, slow, dictionary, key, value, a4, a5);
+  Counters* counters = masm->isolate()->counters();
+  __ IncrementCounter(counters->keyed_store_generic_dictionary(), 1, a4, a5);
+  __ Ret();
+}
+
+
 void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                    StrictMode strict_mode) {
   // ---------- S t a t e --------------
@@ -829,7 +864,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   // -----------------------------------
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
-  Label array, extra, check_if_double_array;
+  Label array, extra, check_if_double_array, maybe_name_key;
 
   // Register usage.
   Register value = StoreDescriptor::ValueRegister();
@@ -841,8 +876,6 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   Register elements = a7;  // Elements array of the receiver.
   // a4 and a5 are used as general scratch registers.
 
-  // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow);
   // Check that the object isn't a smi.
   __ JumpIfSmi(receiver, &slow);
   // Get the map of the object.
@@ -853,6 +886,8 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ And(a4, a4,
          Operand(1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved));
   __ Branch(&slow, ne, a4, Operand(zero_reg));
+  // Check that the key is a smi.
+  __ JumpIfNotSmi(key, &maybe_name_key);
   // Check if the object is a JS array or not.
   __ lbu(a4, FieldMemOperand(receiver_map, Map::kInstanceTypeOffset));
   __ Branch(&array, eq, a4, Operand(JS_ARRAY_TYPE));
@@ -873,6 +908,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   // a2: receiver.
   PropertyICCompiler::GenerateRuntimeSetProperty(masm, strict_mode);
 
+  __ bind(&maybe_name_key);
+  KeyedStoreGenerateDictionaryStore(masm, receiver_map, &slow);
+
   // Extra capacity case: Check if there is extra capacity to
   // perform the store and update the length. Used for adding one
   // element to the array by writing to array[array.length].
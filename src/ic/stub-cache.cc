@@ -12,12 +12,25 @@ namespace v8 {
 namespace internal {
 
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {}
+StubCache::StubCache(Isolate* isolate)
+    : primary_size_(1 << TableBits(FLAG_stub_cache_primary_bits)),
+      secondary_size_(1 << TableBits(FLAG_stub_cache_secondary_bits)),
+      primary_mask_((primary_size_ - 1) << kCacheIndexShift),
+      secondary_mask_((secondary_size_ - 1) << kCacheIndexShift),
+      primary_(NewArray<Entry>(primary_size_)),
+      secondary_(NewArray<Entry>(secondary_size_)),
+      isolate_(isolate) {}
+
+
+StubCache::~StubCache() {
+  DeleteArray(primary_);
+  DeleteArray(secondary_);
+}
 
 
 void StubCache::Initialize() {
-  DCHECK(base::bits::IsPowerOfTwo32(kPrimaryTableSize));
-  DCHECK(base::bits::IsPowerOfTwo32(kSecondaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo32(primary_size_));
+  DCHECK(base::bits::IsPowerOfTwo32(secondary_size_));
   Clear();
 }
 
@@ -62,6 +75,9 @@ Code* StubCache::Set(Name* name, Map* map, Code* code) {
     int seed = PrimaryOffset(primary->key, old_flags, old_map);
     int secondary_offset = SecondaryOffset(primary->key, old_flags, seed);
     Entry* secondary = entry(secondary_, secondary_offset);
+    if (secondary->value != isolate_->builtins()->builtin(Builtins::kIllegal)) {
+      isolate()->counters()->megamorphic_stub_cache_evictions()->Increment();
+    }
     *secondary = *primary;
   }
 
@@ -92,12 +108,13 @@ Code* StubCache::Get(Name* name, Map* map, Code::Flags flags) {
 
 void StubCache::Clear() {
   Code* empty = isolate_->builtins()->builtin(Builtins::kIllegal);
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  RecordOccupancy(empty);
+  for (int i = 0; i < primary_size_; i++) {
     primary_[i].key = isolate()->heap()->empty_string();
     primary_[i].map = NULL;
     primary_[i].value = empty;
   }
-  for (int j = 0; j < kSecondaryTableSize; j++) {
+  for (int j = 0; j < secondary_size_; j++) {
     secondary_[j].key = isolate()->heap()->empty_string();
     secondary_[j].map = NULL;
     secondary_[j].value = empty;
@@ -105,11 +122,34 @@ void StubCache::Clear() {
 }
 
 
+void StubCache::RecordOccupancy(Code* empty) {
+  // The cache is flushed on every mark-compact, so its fill level right
+  // before the flush tells how well the table sizes fit the workload.
+  Counters* counters = isolate()->counters();
+  if (!counters->stub_cache_primary_occupancy()->Enabled() &&
+      !counters->stub_cache_secondary_occupancy()->Enabled()) {
+    return;
+  }
+  int primary_used = 0;
+  for (int i = 0; i < primary_size_; i++) {
+    if (primary_[i].value != empty) primary_used++;
+  }
+  int secondary_used = 0;
+  for (int j = 0; j < secondary_size_; j++) {
+    if (secondary_[j].value != empty) secondary_used++;
+  }
+  counters->stub_cache_primary_occupancy()->AddSample(
+      primary_used * 100 / primary_size_);
+  counters->stub_cache_secondary_occupancy()->AddSample(
+      secondary_used * 100 / secondary_size_);
+}
+
+
 void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
                                     Code::Flags flags,
                                     Handle<Context> native_context,
                                     Zone* zone) {
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  for (int i = 0; i < primary_size_; i++) {
     if (primary_[i].key == *name) {
       Map* map = primary_[i].map;
       // Map can be NULL, if the stub is constant function call
@@ -124,7 +164,7 @@ void StubCache::CollectMatchingMaps(SmallMapList* types, Handle<Name> name,
     }
   }
 
-  for (int i = 0; i < kSecondaryTableSize; i++) {
+  for (int i = 0; i < secondary_size_; i++) {
     if (secondary_[i].key == *name) {
       Map* map = secondary_[i].map;
       // Map can be NULL, if the stub is constant function call
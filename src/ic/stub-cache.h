@@ -72,6 +72,19 @@ class StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  // The generated probes load the masks from here, so that the stubs in the
+  // snapshot work with the table sizes of any isolate.
+  SCTableReference mask_reference(StubCache::Table table) {
+    switch (table) {
+      case StubCache::kPrimary:
+        return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+      case StubCache::kSecondary:
+        return SCTableReference(reinterpret_cast<Address>(&secondary_mask_));
+    }
+    UNREACHABLE();
+    return SCTableReference(NULL);
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -85,6 +98,8 @@ class StubCache {
 
   Isolate* isolate() { return isolate_; }
 
+  ~StubCache();
+
   // Setting the entry size such that the index is shifted by Name::kHashShift
   // is convenient; shifting down the length field (to extract the hash code)
   // automatically discards the hash bit field.
@@ -103,7 +118,7 @@ class StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Name* name, Code::Flags flags, Map* map) {
+  int PrimaryOffset(Name* name, Code::Flags flags, Map* map) const {
     STATIC_ASSERT(kCacheIndexShift == Name::kHashShift);
     // Compute the hash of the name (use entire hash field).
     DCHECK(name->HasHashCode());
@@ -119,13 +134,13 @@ class StubCache {
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     // Base the offset on a simple combination of name, flags, and map.
     uint32_t key = (map_low32bits + field) ^ iflags;
-    return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+    return static_cast<int>(key & primary_mask_);
   }
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int SecondaryOffset(Name* name, Code::Flags flags, int seed) {
+  int SecondaryOffset(Name* name, Code::Flags flags, int seed) const {
     // Use the seed from the primary cache in the secondary cache.
     uint32_t name_low32bits =
         static_cast<uint32_t>(reinterpret_cast<uintptr_t>(name));
@@ -134,7 +149,7 @@ class StubCache {
     uint32_t iflags =
         (static_cast<uint32_t>(flags) & ~Code::kFlagsNotUsedInLookup);
     uint32_t key = (seed - name_low32bits) + iflags;
-    return key & ((kSecondaryTableSize - 1) << kCacheIndexShift);
+    return static_cast<int>(key & secondary_mask_);
   }
 
   // Compute the entry for a given offset in exactly the same way as
@@ -148,13 +163,28 @@ class StubCache {
                                     offset * multiplier);
   }
 
-  static const int kPrimaryTableBits = 11;
-  static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
-  static const int kSecondaryTableBits = 9;
-  static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
+  // Sample the fill level of both tables into the occupancy histograms.
+  void RecordOccupancy(Code* empty);
+
+  // The table sizes are set per isolate by --stub-cache-primary-bits and
+  // --stub-cache-secondary-bits, within these bounds.
+  static const int kMinTableBits = 4;
+  static const int kMaxTableBits = 16;
+
+  // Any mask of a table of at most 1 << kMaxTableBits entries, unscaled.
+  static const int kMaxTableMask = (1 << kMaxTableBits) - 1;
+
+  static int TableBits(int bits) {
+    return Min(kMaxTableBits, Max(kMinTableBits, bits));
+  }
 
-  Entry primary_[kPrimaryTableSize];
-  Entry secondary_[kSecondaryTableSize];
+  int primary_size_;
+  int secondary_size_;
+  // The masks of both tables, scaled by 1 << kCacheIndexShift.
+  intptr_t primary_mask_;
+  intptr_t secondary_mask_;
+  Entry* primary_;
+  Entry* secondary_;
   Isolate* isolate_;
 
   friend class Isolate;
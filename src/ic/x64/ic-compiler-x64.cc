@@ -125,6 +125,31 @@ Handle<Code> PropertyICCompiler::CompilePolymorphic(TypeHandleList* types,
 }
 
 
+Handle<Code> PropertyICCompiler::CompileShapeFamily(Handle<Cell> descriptors,
+                                                    int min_own_descriptors,
+                                                    Handle<Code> handler,
+                                                    Handle<Name> name) {
+  Label miss;
+  __ JumpIfSmi(receiver(), &miss);
+
+  Register map_reg = scratch1();
+  Register scratch = scratch2();
+  __ movp(map_reg, FieldOperand(receiver(), HeapObject::kMapOffset));
+  __ NumberOfOwnDescriptors(scratch, map_reg);
+  __ cmpl(scratch, Immediate(min_own_descriptors));
+  __ j(less, &miss);
+  __ LoadInstanceDescriptors(map_reg, map_reg);
+  __ Move(scratch, descriptors);
+  __ cmpp(map_reg, FieldOperand(scratch, Cell::kValueOffset));
+  __ j(equal, handler, RelocInfo::CODE_TARGET);
+
+  __ bind(&miss);
+  TailCallBuiltin(masm(), MissBuiltin(kind()));
+
+  return GetCode(kind(), Code::NORMAL, name, POLYMORPHIC);
+}
+
+
 #undef __
 }
 }  // namespace v8::internal
@@ -609,12 +609,47 @@ static void KeyedStoreGenerateGenericHelper(
 }
 
 
+// Stores to an existing, writable data property of a receiver with dictionary
+// properties. Objects that are used as hash maps end up in dictionary mode, so
+// this keeps obj[name] = value out of the runtime for them. Everything else,
+// including stores that would add a property, jumps to slow.
+static void KeyedStoreGenerateDictionaryStore(MacroAssembler* masm,
+                                              Register receiver_map,
+                                              Label* slow) {
+  Register receiver = StoreDescriptor::ReceiverRegister();
+  Register key = StoreDescriptor::NameRegister();
+  Register value = StoreDescriptor::ValueRegister();
+  DCHECK(receiver_map.is(r9));
+
+  // The receiver must be a non-global JSObject without a named interceptor.
+  __ CmpInstanceType(receiver_map, FIRST_JS_OBJECT_TYPE);
+  __ j(below, slow);
+  __ movzxbp(rbx, FieldOperand(receiver_map, Map::kInstanceTypeOffset));
+  GenerateGlobalInstanceTypeCheck(masm, rbx, slow);
+  __ testb(FieldOperand(receiver_map, Map::kBitFieldOffset),
+           Immediate(1 << Map::kHasNamedInterceptor));
+  __ j(not_zero, slow);
+
+  // The key must be a unique name that is not an array index.
+  GenerateKeyNameCheck(masm, key, rbx, rdi, slow, slow);
+
+  __ movp(rbx, FieldOperand(receiver, JSObject::kPropertiesOffset));
+  __ CompareRoot(FieldOperand(rbx, HeapObject::kMapOffset),
+                 Heap::kHashTableMapRootIndex);
+  __ j(not_equal, slow);
+  GenerateDictionaryStore(masm, slow, rbx, key, value, rdi, r8);
+  Counters* counters = masm->isolate()->counters();
+  __ IncrementCounter(counters->keyed_store_generic_dictionary(), 1);
+  __ ret(0);
+}
+
+
 void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                    StrictMode strict_mode) {
   // Return address is on the stack.
   Label slow, slow_with_tagged_index, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
-  Label array, extra, check_if_double_array;
+  Label array, extra, check_if_double_array, maybe_name_key;
   Register receiver = StoreDescriptor::ReceiverRegister();
   Register key = StoreDescriptor::NameRegister();
   DCHECK(receiver.is(rdx));
@@ -630,7 +665,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
            Immediate(1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved));
   __ j(not_zero, &slow_with_tagged_index);
   // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow_with_tagged_index);
+  __ JumpIfNotSmi(key, &maybe_name_key);
   __ SmiToInteger32(key, key);
 
   __ CmpInstanceType(r9, JS_ARRAY_TYPE);
@@ -653,6 +688,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   PropertyICCompiler::GenerateRuntimeSetProperty(masm, strict_mode);
   // Never returns to here.
 
+  __ bind(&maybe_name_key);
+  KeyedStoreGenerateDictionaryStore(masm, r9, &slow_with_tagged_index);
+
   // Extra capacity case: Check if there is extra capacity to
   // perform the store and update the length. Used for adding one
   // element to the array by writing to array[array.length].
@@ -741,12 +741,57 @@ static void KeyedStoreGenerateGenericHelper(
 }
 
 
+// Stores to an existing, writable data property of a receiver with dictionary
+// properties. Objects that are used as hash maps end up in dictionary mode, so
+// this keeps obj[name] = value out of the runtime for them. Everything else,
+// including stores that would add a property, jumps to slow.
+static void KeyedStoreGenerateDictionaryStore(MacroAssembler* masm,
+                                              Register receiver_map,
+                                              Label* slow) {
+  Register receiver = StoreDescriptor::ReceiverRegister();
+  Register key = StoreDescriptor::NameRegister();
+  Register value = StoreDescriptor::ValueRegister();
+  DCHECK(receiver_map.is(edi));
+
+  // The receiver must be a non-global JSObject without a named interceptor.
+  __ CmpInstanceType(receiver_map, FIRST_JS_OBJECT_TYPE);
+  __ j(below, slow);
+  __ movzx_b(ebx, FieldOperand(receiver_map, Map::kInstanceTypeOffset));
+  GenerateGlobalInstanceTypeCheck(masm, ebx, slow);
+  __ test_b(FieldOperand(receiver_map, Map::kBitFieldOffset),
+            1 << Map::kHasNamedInterceptor);
+  __ j(not_zero, slow);
+
+  // The key must be a unique name that is not an array index.
+  GenerateKeyNameCheck(masm, key, ebx, edi, slow, slow);
+
+  __ mov(ebx, FieldOperand(receiver, JSObject::kPropertiesOffset));
+  __ cmp(FieldOperand(ebx, HeapObject::kMapOffset),
+         Immediate(masm->isolate()->factory()->hash_table_map()));
+  __ j(not_equal, slow);
+
+  // Push and restore the receiver to free up a register for the lookup, as
+  // GenerateDictionaryStore preserves the key and the value.
+  Label restore_slow;
+  __ push(receiver);
+  GenerateDictionaryStore(masm, &restore_slow, ebx, key, value, receiver, edi);
+  __ Drop(1);
+  Counters* counters = masm->isolate()->counters();
+  __ IncrementCounter(counters->keyed_store_generic_dictionary(), 1);
+  __ ret(0);
+
+  __ bind(&restore_slow);
+  __ pop(receiver);
+  __ jmp(slow);
+}
+
+
 void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
                                    StrictMode strict_mode) {
   // Return address is on the stack.
   Label slow, fast_object, fast_object_grow;
   Label fast_double, fast_double_grow;
-  Label array, extra, check_if_double_array;
+  Label array, extra, check_if_double_array, maybe_name_key;
   Register receiver = StoreDescriptor::ReceiverRegister();
   Register key = StoreDescriptor::NameRegister();
   DCHECK(receiver.is(edx));
@@ -762,7 +807,7 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
             1 << Map::kIsAccessCheckNeeded | 1 << Map::kIsObserved);
   __ j(not_zero, &slow);
   // Check that the key is a smi.
-  __ JumpIfNotSmi(key, &slow);
+  __ JumpIfNotSmi(key, &maybe_name_key);
   __ CmpInstanceType(edi, JS_ARRAY_TYPE);
   __ j(equal, &array);
   // Check that the object is some kind of JSObject.
@@ -781,6 +826,9 @@ void KeyedStoreIC::GenerateGeneric(MacroAssembler* masm,
   __ bind(&slow);
   PropertyICCompiler::GenerateRuntimeSetProperty(masm, strict_mode);
 
+  __ bind(&maybe_name_key);
+  KeyedStoreGenerateDictionaryStore(masm, edi, &slow);
+
   // Extra capacity case: Check if there is extra capacity to
   // perform the store and update the length. Used for adding one
   // element to the array by writing to array[array.length].
@@ -137,6 +137,12 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
   Register offset = scratch;
   scratch = no_reg;
 
+  // The masks are loaded since the table sizes are set per isolate.
+  Operand primary_mask =
+      Operand::StaticVariable(ExternalReference(mask_reference(kPrimary)));
+  Operand secondary_mask =
+      Operand::StaticVariable(ExternalReference(mask_reference(kSecondary)));
+
   Counters* counters = masm->isolate()->counters();
   __ IncrementCounter(counters->megamorphic_stub_cache_probes(), 1);
 
@@ -149,7 +155,7 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
   __ xor_(offset, flags);
   // We mask out the last two bits because they are not part of the hash and
   // they are always 01 for maps.  Also in the two 'and' instructions below.
-  __ and_(offset, (kPrimaryTableSize - 1) << kCacheIndexShift);
+  __ and_(offset, primary_mask);
   // ProbeTable expects the offset to be pointer scaled, which it is, because
   // the heap object tag size is 2 and the pointer size log 2 is also 2.
   DCHECK(kCacheIndexShift == kPointerSizeLog2);
@@ -157,14 +163,16 @@ void StubCache::GenerateProbe(MacroAssembler* masm, Code::Flags flags,
   // Probe the primary table.
   ProbeTable(isolate(), masm, flags, kPrimary, name, receiver, offset, extra);
 
+  __ IncrementCounter(counters->megamorphic_stub_cache_secondary_probes(), 1);
+
   // Primary miss: Compute hash for secondary probe.
   __ mov(offset, FieldOperand(name, Name::kHashFieldOffset));
   __ add(offset, FieldOperand(receiver, HeapObject::kMapOffset));
   __ xor_(offset, flags);
-  __ and_(offset, (kPrimaryTableSize - 1) << kCacheIndexShift);
+  __ and_(offset, primary_mask);
   __ sub(offset, name);
   __ add(offset, Immediate(flags));
-  __ and_(offset, (kSecondaryTableSize - 1) << kCacheIndexShift);
+  __ and_(offset, secondary_mask);
 
   // Probe the secondary table.
   ProbeTable(isolate(), masm, flags, kSecondary, name, receiver, offset, extra);
@@ -13,6 +13,7 @@
 #include "src/bootstrapper.h"
 #include "src/codegen.h"
 #include "src/compilation-cache.h"
+#include "src/compilation-statistics.h"
 #include "src/cpu-profiler.h"
 #include "src/debug.h"
 #include "src/deoptimizer.h"
@@ -1723,6 +1724,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = NULL;
 
+  delete compilation_statistics();
+  set_compilation_statistics(NULL);
+
   delete logger_;
   logger_ = NULL;
 
@@ -1832,6 +1836,7 @@ bool Isolate::Init(Deserializer* des) {
   TRACE_ISOLATE(init);
 
   stress_deopt_count_ = FLAG_deopt_every_n_times;
+  set_compilation_statistics(new CompilationStatistics());
 
   has_fatal_error_ = false;
 
@@ -2239,7 +2244,8 @@ Handle<JSObject> Isolate::GetSymbolRegistry() {
     for (unsigned i = 0; i < arraysize(nested); ++i) {
       Handle<String> name = factory()->InternalizeUtf8String(nested[i]);
       Handle<JSObject> obj = factory()->NewJSObjectFromMap(map);
-      JSObject::NormalizeProperties(obj, KEEP_INOBJECT_PROPERTIES, 8);
+      JSObject::NormalizeProperties(obj, KEEP_INOBJECT_PROPERTIES, 8,
+                                    "SetupSymbolRegistry");
       JSObject::SetProperty(registry, name, obj, STRICT).Assert();
     }
   }
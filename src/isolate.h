@@ -38,6 +38,7 @@ class CodeGenerator;
 class CodeRange;
 class CodeStubInterfaceDescriptor;
 class CodeTracer;
+class CompilationStatistics;
 class CompilationCache;
 class ConsStringIteratorOp;
 class ContextSlotCache;
@@ -377,6 +378,7 @@ typedef List<HeapObject*> DebugObjectCache;
   V(bool, autorun_microtasks, true)                                            \
   V(HStatistics*, hstatistics, NULL)                                           \
   V(HStatistics*, tstatistics, NULL)                                           \
+  V(CompilationStatistics*, compilation_statistics, NULL)                      \
   V(HTracer*, htracer, NULL)                                                   \
   V(CodeTracer*, code_tracer, NULL)                                            \
   V(bool, fp_stubs_generated, false)                                           \
@@ -1713,13 +1713,19 @@ void LAllocator::FreeSpillSlot(LiveRange* range) {
 
 
 LOperand* LAllocator::TryReuseSpillSlot(LiveRange* range) {
-  if (reusable_slots_.is_empty()) return NULL;
-  if (reusable_slots_.first()->End().Value() >
-      range->TopLevel()->Start().Value()) {
-    return NULL;
-  }
-  LOperand* result = reusable_slots_.first()->TopLevel()->GetSpillOperand();
-  reusable_slots_.Remove(0);
+  // Any slot whose previous owner ended before {range} starts can be shared.
+  // Pick the one freed last, keeping slots freed earlier for ranges that
+  // start earlier.
+  int start = range->TopLevel()->Start().Value();
+  int best = -1;
+  for (int i = 0; i < reusable_slots_.length(); ++i) {
+    int end = reusable_slots_[i]->End().Value();
+    if (end > start) continue;
+    if (best < 0 || end > reusable_slots_[best]->End().Value()) best = i;
+  }
+  if (best < 0) return NULL;
+  LOperand* result = reusable_slots_[best]->TopLevel()->GetSpillOperand();
+  reusable_slots_.Remove(best);
   return result;
 }
 
@@ -863,6 +863,7 @@ void ExecutableAccessorInfo::ExecutableAccessorInfoVerify() {
   VerifyPointer(getter());
   VerifyPointer(setter());
   VerifyPointer(data());
+  VerifyPointer(load_handler());
 }
 
 
@@ -5288,6 +5288,7 @@ ACCESSORS(DeclaredAccessorInfo, descriptor, DeclaredAccessorDescriptor,
 ACCESSORS(ExecutableAccessorInfo, getter, Object, kGetterOffset)
 ACCESSORS(ExecutableAccessorInfo, setter, Object, kSetterOffset)
 ACCESSORS(ExecutableAccessorInfo, data, Object, kDataOffset)
+ACCESSORS(ExecutableAccessorInfo, load_handler, Object, kLoadHandlerOffset)
 
 ACCESSORS(Box, value, Object, kValueOffset)
 
@@ -6867,6 +6868,18 @@ void NameDictionary::DoGenerateNewEnumerationIndices(
 }
 
 
+int NameDictionary::StableLoadCount() {
+  Object* count = get(kStableLoadCountIndex);
+  if (!count->IsSmi()) return 0;
+  return Smi::cast(count)->value();
+}
+
+
+void NameDictionary::SetStableLoadCount(int count) {
+  set(kStableLoadCountIndex, Smi::FromInt(count));
+}
+
+
 bool ObjectHashTableShape::IsMatch(Handle<Object> key, Object* other) {
   return key->SameValue(other);
 }
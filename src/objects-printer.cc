@@ -881,6 +881,7 @@ void ExecutableAccessorInfo::ExecutableAccessorInfoPrint(
   os << "\n - getter: " << Brief(getter());
   os << "\n - setter: " << Brief(setter());
   os << "\n - data: " << Brief(data());
+  os << "\n - load_handler: " << Brief(load_handler());
   os << "\n";
 }
 
@@ -660,6 +660,7 @@ void JSObject::SetNormalizedProperty(Handle<JSObject> object,
 
     property_dictionary = NameDictionary::Add(
         property_dictionary, name, store_value, details);
+    property_dictionary->SetStableLoadCount(0);
     object->set_properties(*property_dictionary);
     return;
   }
@@ -719,6 +720,7 @@ Handle<Object> JSObject::DeleteNormalizedProperty(Handle<JSObject> object,
       Handle<Object> deleted(
           NameDictionary::DeleteProperty(dictionary, entry, mode));
       if (*deleted == isolate->heap()->true_value()) {
+        dictionary->SetStableLoadCount(0);
         Handle<NameDictionary> new_properties =
             NameDictionary::Shrink(dictionary, name);
         object->set_properties(*new_properties);
@@ -1801,6 +1803,7 @@ void JSObject::AddSlowProperty(Handle<JSObject> object,
   PropertyDetails details = PropertyDetails(attributes, NORMAL, 0);
   Handle<NameDictionary> result =
       NameDictionary::Add(dict, name, value, details);
+  result->SetStableLoadCount(0);
   if (*dict != *result) object->set_properties(*result);
 }
 
@@ -4162,11 +4165,12 @@ void HeapObject::UpdateMapCodeCache(Handle<HeapObject> object,
 
 void JSObject::NormalizeProperties(Handle<JSObject> object,
                                    PropertyNormalizationMode mode,
-                                   int expected_additional_properties) {
+                                   int expected_additional_properties,
+                                   const char* reason) {
   if (!object->HasFastProperties()) return;
 
   Handle<Map> map(object->map());
-  Handle<Map> new_map = Map::Normalize(map, mode);
+  Handle<Map> new_map = Map::Normalize(map, mode, reason);
 
   MigrateFastToSlow(object, new_map, expected_additional_properties);
 }
@@ -4410,6 +4414,89 @@ void JSObject::MigrateSlowToFast(Handle<JSObject> object,
 }
 
 
+void JSObject::RecordDictionaryLoad(Handle<JSObject> object) {
+  if (!FLAG_reoptimize_dictionary_objects) return;
+  if (object->HasFastProperties() || object->IsGlobalObject()) return;
+  // Prototypes are migrated back by JSObject::OptimizeAsPrototype.
+  if (object->map()->is_prototype_map()) return;
+
+  Handle<NameDictionary> dictionary(object->property_dictionary());
+  int count = dictionary->StableLoadCount();
+  if (count < FLAG_dictionary_reoptimize_threshold) {
+    dictionary->SetStableLoadCount(count + 1);
+    return;
+  }
+  // Keyed stores and deletes normalize objects with more properties than
+  // this (see Map::TooManyFastProperties), so leave them in dictionary mode.
+  int entry_count = dictionary->NumberOfElements();
+  if (entry_count > Map::kFastPropertiesSoftLimit) return;
+
+  Handle<Map> dictionary_map(object->map());
+  if (dictionary_map->is_observed() || !dictionary_map->is_extensible() ||
+      dictionary_map->is_access_check_needed()) {
+    return;
+  }
+
+  // Objects are reoptimized at most once; one that went back to dictionary
+  // mode afterwards is not going to settle.
+  Isolate* isolate = object->GetIsolate();
+  Handle<Symbol> reoptimized = isolate->factory()->reoptimized_symbol();
+  if (!object->GetHiddenProperty(reoptimized)->IsTheHole()) return;
+
+  // Collect the entries in enumeration order, keeping accessors and hidden
+  // properties in dictionary mode.
+  int entries[Map::kFastPropertiesSoftLimit];
+  int found = 0;
+  int capacity = dictionary->Capacity();
+  for (int i = 0; i < capacity; i++) {
+    Object* key = dictionary->KeyAt(i);
+    if (!dictionary->IsKey(key)) continue;
+    PropertyDetails details = dictionary->DetailsAt(i);
+    if (details.type() != NORMAL) return;
+    if (key == isolate->heap()->hidden_string()) return;
+    int index = details.dictionary_index();
+    int j = found++;
+    for (; j > 0 &&
+           dictionary->DetailsAt(entries[j - 1]).dictionary_index() > index;
+         j--) {
+      entries[j] = entries[j - 1];
+    }
+    entries[j] = i;
+  }
+  DCHECK_EQ(entry_count, found);
+
+  if (FLAG_trace_property_normalization) {
+    OFStream os(stdout);
+    os << "[reoptimizing ";
+    dictionary_map->constructor_name()->PrintOn(stdout);
+    os << " after " << count << " loads]" << endl;
+  }
+
+  Handle<Map> root_map = Map::ReoptimizedRootMap(dictionary_map);
+  {
+    DisallowHeapAllocation no_allocation;
+    Object* undefined = isolate->heap()->undefined_value();
+    for (int i = 0; i < root_map->inobject_properties(); i++) {
+      object->InObjectPropertyAtPut(i, undefined, SKIP_WRITE_BARRIER);
+    }
+    object->synchronized_set_map(*root_map);
+    object->set_properties(isolate->heap()->empty_fixed_array());
+  }
+  for (int i = 0; i < entry_count; i++) {
+    Handle<Object> key(dictionary->KeyAt(entries[i]), isolate);
+    Handle<Name> name = Handle<Name>::cast(key);
+    if (key->IsString()) {
+      name = isolate->factory()->InternalizeString(Handle<String>::cast(key));
+    }
+    Handle<Object> value(dictionary->ValueAt(entries[i]), isolate);
+    AddProperty(object, name, value,
+                dictionary->DetailsAt(entries[i]).attributes());
+  }
+  SetHiddenProperty(object, reoptimized, isolate->factory()->true_value());
+  isolate->counters()->props_to_fast_reoptimized()->Increment();
+}
+
+
 void JSObject::ResetElements(Handle<JSObject> object) {
   Isolate* isolate = object->GetIsolate();
   CHECK(object->map() != isolate->heap()->sloppy_arguments_elements_map());
@@ -4981,7 +5068,7 @@ MaybeHandle<Object> JSObject::DeleteProperty(Handle<JSObject> object,
             !(object->IsJSGlobalProxy() && holder->IsJSGlobalObject())) {
           return it.isolate()->factory()->true_value();
         }
-        NormalizeProperties(holder, mode, 0);
+        NormalizeProperties(holder, mode, 0, "DeleteProperty");
         Handle<Object> result =
             DeleteNormalizedProperty(holder, name, delete_mode);
         ReoptimizeIfPrototype(holder);
@@ -5306,7 +5393,7 @@ MaybeHandle<Object> JSObject::Freeze(Handle<JSObject> object) {
   } else {
     DCHECK(old_map->is_dictionary_map() || !old_map->is_prototype_map());
     // Slow path: need to normalize properties for safety
-    NormalizeProperties(object, CLEAR_INOBJECT_PROPERTIES, 0);
+    NormalizeProperties(object, CLEAR_INOBJECT_PROPERTIES, 0, "Freeze");
 
     // Create a new map, since other objects with this map may be extensible.
     // TODO(adamk): Extend the NormalizedMapCache to handle non-extensible maps.
@@ -6069,7 +6156,7 @@ void JSObject::SetPropertyCallback(Handle<JSObject> object,
                                        ? KEEP_INOBJECT_PROPERTIES
                                        : CLEAR_INOBJECT_PROPERTIES;
   // Normalize object to make this operation simple.
-  NormalizeProperties(object, mode, 0);
+  NormalizeProperties(object, mode, 0, "SetPropertyCallback");
 
   // For the global object allocate a new map to invalidate the global inline
   // caches which have a global property cell reference directly in the code.
@@ -6394,10 +6481,18 @@ Handle<Map> Map::RawCopy(Handle<Map> map, int instance_size) {
 
 
 Handle<Map> Map::Normalize(Handle<Map> fast_map,
-                           PropertyNormalizationMode mode) {
+                           PropertyNormalizationMode mode,
+                           const char* reason) {
   DCHECK(!fast_map->is_dictionary_map());
 
   Isolate* isolate = fast_map->GetIsolate();
+  if (FLAG_trace_property_normalization) {
+    OFStream os(stdout);
+    os << "[normalizing ";
+    fast_map->constructor_name()->PrintOn(stdout);
+    os << " (" << reason << ")]" << endl;
+  }
+
   Handle<Object> maybe_cache(isolate->native_context()->normalized_map_cache(),
                              isolate);
   bool use_cache = !maybe_cache->IsUndefined();
@@ -6463,6 +6558,33 @@ Handle<Map> Map::CopyNormalized(Handle<Map> map,
 }
 
 
+Handle<Map> Map::ReoptimizedRootMap(Handle<Map> dictionary_map) {
+  DCHECK(dictionary_map->is_dictionary_map());
+  Isolate* isolate = dictionary_map->GetIsolate();
+  Handle<Object> maybe_cache(
+      isolate->native_context()->reoptimized_map_cache(), isolate);
+  uint32_t hash = static_cast<uint32_t>(dictionary_map->Hash());
+  int index = (hash % kReoptimizedMapCacheEntries) * 2;
+  if (maybe_cache->IsFixedArray()) {
+    FixedArray* cache = FixedArray::cast(*maybe_cache);
+    if (cache->get(index) == *dictionary_map) {
+      return handle(Map::cast(cache->get(index + 1)), isolate);
+    }
+  }
+
+  Handle<Map> root_map = CopyDropDescriptors(dictionary_map);
+  root_map->set_dictionary_map(false);
+  root_map->set_unused_property_fields(root_map->inobject_properties());
+
+  if (maybe_cache->IsFixedArray()) {
+    Handle<FixedArray> cache = Handle<FixedArray>::cast(maybe_cache);
+    cache->set(index, *dictionary_map);
+    cache->set(index + 1, *root_map);
+  }
+  return root_map;
+}
+
+
 Handle<Map> Map::CopyDropDescriptors(Handle<Map> map) {
   Handle<Map> result = RawCopy(map, map->instance_size());
 
@@ -6776,7 +6898,8 @@ Handle<Map> Map::TransitionToDataProperty(Handle<Map> map, Handle<Name> name,
     // TODO(verwaest): Handle attributes better.
     DescriptorArray* descriptors = transition->instance_descriptors();
     if (descriptors->GetDetails(descriptor).attributes() != attributes) {
-      return Map::Normalize(map, CLEAR_INOBJECT_PROPERTIES);
+      return Map::Normalize(map, CLEAR_INOBJECT_PROPERTIES,
+                            "DataPropertyWithAttributes");
     }
 
     return Map::PrepareForDataProperty(transition, descriptor, value);
@@ -6796,7 +6919,8 @@ Handle<Map> Map::TransitionToDataProperty(Handle<Map> map, Handle<Name> name,
 
   Handle<Map> result;
   if (!maybe_map.ToHandle(&result)) {
-    return Map::Normalize(map, CLEAR_INOBJECT_PROPERTIES);
+    return Map::Normalize(map, CLEAR_INOBJECT_PROPERTIES,
+                          "TooManyFastProperties");
   }
 
   return result;
@@ -6849,22 +6973,22 @@ Handle<Map> Map::TransitionToAccessorProperty(Handle<Map> map,
     }
 
     if (descriptors->GetDetails(descriptor).type() != CALLBACKS) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsOverwritingNonAccessors");
     }
 
     // TODO(verwaest): Handle attributes better.
     if (descriptors->GetDetails(descriptor).attributes() != attributes) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsWithAttributes");
     }
 
     Handle<Object> maybe_pair(descriptors->GetValue(descriptor), isolate);
     if (!maybe_pair->IsAccessorPair()) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsOverwritingNonPair");
     }
 
     Handle<AccessorPair> pair = Handle<AccessorPair>::cast(maybe_pair);
     if (pair->get(component) != *accessor) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsOverwritingAccessors");
     }
 
     return transition;
@@ -6876,29 +7000,29 @@ Handle<Map> Map::TransitionToAccessorProperty(Handle<Map> map,
   if (descriptor != DescriptorArray::kNotFound) {
     PropertyDetails old_details = old_descriptors->GetDetails(descriptor);
     if (old_details.type() != CALLBACKS) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsOverwritingNonAccessors");
     }
 
     if (old_details.attributes() != attributes) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsWithAttributes");
     }
 
     Handle<Object> maybe_pair(old_descriptors->GetValue(descriptor), isolate);
     if (!maybe_pair->IsAccessorPair()) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsOverwritingNonPair");
     }
 
     Object* current = Handle<AccessorPair>::cast(maybe_pair)->get(component);
     if (current == *accessor) return map;
 
     if (!current->IsTheHole()) {
-      return Map::Normalize(map, mode);
+      return Map::Normalize(map, mode, "AccessorsOverwritingAccessors");
     }
 
     pair = AccessorPair::Copy(Handle<AccessorPair>::cast(maybe_pair));
   } else if (map->NumberOfOwnDescriptors() >= kMaxNumberOfDescriptors ||
              map->TooManyFastProperties(CERTAINLY_NOT_STORE_FROM_KEYED)) {
-    return Map::Normalize(map, CLEAR_INOBJECT_PROPERTIES);
+    return Map::Normalize(map, CLEAR_INOBJECT_PROPERTIES, "TooManyAccessors");
   } else {
     pair = isolate->factory()->NewAccessorPair();
   }
@@ -9358,7 +9482,8 @@ void JSObject::OptimizeAsPrototype(Handle<JSObject> object,
   if (object->IsJSGlobalProxy()) return;
   if (mode == FAST_PROTOTYPE && !object->map()->is_prototype_map()) {
     // First normalize to ensure all JSFunctions are CONSTANT.
-    JSObject::NormalizeProperties(object, KEEP_INOBJECT_PROPERTIES, 0);
+    JSObject::NormalizeProperties(object, KEEP_INOBJECT_PROPERTIES, 0,
+                                  "OptimizeAsPrototype");
   }
   if (!object->HasFastProperties()) {
     JSObject::MigrateSlowToFast(object, 0);
@@ -15482,9 +15607,15 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Shrink(
   DCHECK(!table->IsObsolete());
 
   int nof = table->NumberOfElements();
+  int nod = table->NumberOfDeletedElements();
   int capacity = table->Capacity();
-  if (nof >= (capacity >> 2)) return table;
-  return Rehash(table, capacity / 2);
+  if (nof < (capacity >> 2)) return Rehash(table, capacity / 2);
+  // Holes are otherwise only dropped once the table is full, so a table
+  // used as a queue would keep iterating over up to |capacity| dead entries.
+  // At least |nof| removals happen between two compactions, which keeps the
+  // cost amortized constant per removal.
+  if (nod > nof) return Rehash(table, capacity);
+  return table;
 }
 
 
@@ -15528,12 +15659,30 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Rehash(
       Allocate(table->GetIsolate(),
                new_capacity,
                table->GetHeap()->InNewSpace(*table) ? NOT_TENURED : TENURED);
+  DisallowHeapAllocation no_gc;
   int nof = table->NumberOfElements();
   int nod = table->NumberOfDeletedElements();
+  int old_buckets = table->NumberOfBuckets();
   int new_buckets = new_table->NumberOfBuckets();
   int new_entry = 0;
   int removed_holes_index = 0;
 
+  // When the table does not grow, the new bucket of an entry only depends on
+  // its old bucket. Record the old buckets in the chain slots, which are not
+  // needed once the table is obsolete, instead of recomputing the hashes of
+  // all keys (object keys keep theirs in hidden properties).
+  bool rehash_keys = new_buckets > old_buckets;
+  if (!rehash_keys) {
+    for (int bucket = 0; bucket < old_buckets; ++bucket) {
+      int entry = Smi::cast(table->get(kHashTableStartIndex + bucket))->value();
+      while (entry != kNotFound) {
+        int chain_index = table->EntryToIndex(entry) + kChainOffset;
+        entry = Smi::cast(table->get(chain_index))->value();
+        table->set(chain_index, Smi::FromInt(bucket));
+      }
+    }
+  }
+
   for (int old_entry = 0; old_entry < (nof + nod); ++old_entry) {
     Object* key = table->KeyAt(old_entry);
     if (key->IsTheHole()) {
@@ -15541,12 +15690,17 @@ Handle<Derived> OrderedHashTable<Derived, Iterator, entrysize>::Rehash(
       continue;
     }
 
-    Object* hash = key->GetHash();
-    int bucket = Smi::cast(hash)->value() & (new_buckets - 1);
+    int old_index = table->EntryToIndex(old_entry);
+    int bucket;
+    if (rehash_keys) {
+      bucket = Smi::cast(key->GetHash())->value() & (new_buckets - 1);
+    } else {
+      bucket = Smi::cast(table->get(old_index + kChainOffset))->value() &
+               (new_buckets - 1);
+    }
     Object* chain_entry = new_table->get(kHashTableStartIndex + bucket);
     new_table->set(kHashTableStartIndex + bucket, Smi::FromInt(new_entry));
     int new_index = new_table->EntryToIndex(new_entry);
-    int old_index = table->EntryToIndex(old_entry);
     for (int i = 0; i < entrysize; ++i) {
       Object* value = table->get(old_index + i);
       new_table->set(new_index + i, value);
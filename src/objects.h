@@ -2403,7 +2403,8 @@ class JSObject: public JSReceiver {
   // an initial capacity for holding these properties.
   static void NormalizeProperties(Handle<JSObject> object,
                                   PropertyNormalizationMode mode,
-                                  int expected_additional_properties);
+                                  int expected_additional_properties,
+                                  const char* reason);
 
   // Convert and update the elements backing store to be a
   // SeededNumberDictionary dictionary.  Returns the backing after conversion.
@@ -2414,6 +2415,13 @@ class JSObject: public JSReceiver {
   static void MigrateSlowToFast(Handle<JSObject> object,
                                 int unused_property_fields);
 
+  // Called on loads from dictionary mode objects. Migrates the object back
+  // to fast properties once it has been loaded from often enough without
+  // any properties being added or removed in between. Objects with the same
+  // dictionary map and properties share the resulting map, see
+  // Map::ReoptimizedRootMap. Each object is migrated at most once.
+  static void RecordDictionaryLoad(Handle<JSObject> object);
+
   // Access fast-case object properties at index.
   static Handle<Object> FastPropertyAt(Handle<JSObject> object,
                                        Representation representation,
@@ -3999,6 +4007,15 @@ class NameDictionary: public Dictionary<NameDictionary,
   // Find entry for key, otherwise return kNotFound. Optimized version of
   // HashTable::FindEntry.
   int FindEntry(Handle<Name> key);
+
+  // Number of loads from the owning object since a property was last added
+  // or removed, see JSObject::RecordDictionaryLoad.
+  inline int StableLoadCount();
+  inline void SetStableLoadCount(int count);
+
+ private:
+  // Property dictionaries have no use for the max number key slot.
+  static const int kStableLoadCountIndex = kMaxNumberKeyIndex;
 };
 
 
@@ -4206,8 +4223,8 @@ class OrderedHashTable: public FixedArray {
   // to add at least one new element.
   static Handle<Derived> EnsureGrowable(Handle<Derived> table);
 
-  // Returns an OrderedHashTable (possibly |table|) that's shrunken
-  // if possible.
+  // Returns an OrderedHashTable (possibly |table|) that's shrunken, or
+  // compacted if most of its used entries have been removed.
   static Handle<Derived> Shrink(Handle<Derived> table);
 
   // Returns a new empty OrderedHashTable and records the clearing so that
@@ -4239,6 +4256,10 @@ class OrderedHashTable: public FixedArray {
     return Smi::cast(get(kNumberOfBucketsIndex))->value();
   }
 
+  int Capacity() {
+    return NumberOfBuckets() * kLoadFactor;
+  }
+
   // Returns the index into the data table where the new entry
   // should be placed. The table is assumed to have enough space
   // for a new entry.
@@ -4272,6 +4293,15 @@ class OrderedHashTable: public FixedArray {
   static const int kNotFound = -1;
   static const int kMinCapacity = 4;
 
+  // Layout of the table, used by optimized code to find entries.
+  static const int kNumberOfBucketsIndex = 0;
+  static const int kNumberOfElementsIndex = kNumberOfBucketsIndex + 1;
+  static const int kNumberOfDeletedElementsIndex = kNumberOfElementsIndex + 1;
+  static const int kHashTableStartIndex = kNumberOfDeletedElementsIndex + 1;
+
+  static const int kEntrySize = entrysize + 1;
+  static const int kChainOffset = entrysize;
+
  private:
   static Handle<Derived> Rehash(Handle<Derived> table, int new_capacity);
 
@@ -4287,10 +4317,6 @@ class OrderedHashTable: public FixedArray {
     set(kNumberOfDeletedElementsIndex, Smi::FromInt(num));
   }
 
-  int Capacity() {
-    return NumberOfBuckets() * kLoadFactor;
-  }
-
   // Returns the next entry for the given entry.
   int ChainAt(int entry) {
     return Smi::cast(get(EntryToIndex(entry) + kChainOffset))->value();
@@ -4313,17 +4339,9 @@ class OrderedHashTable: public FixedArray {
     return set(kRemovedHolesIndex + index, Smi::FromInt(removed_index));
   }
 
-  static const int kNumberOfBucketsIndex = 0;
-  static const int kNumberOfElementsIndex = kNumberOfBucketsIndex + 1;
-  static const int kNumberOfDeletedElementsIndex = kNumberOfElementsIndex + 1;
-  static const int kHashTableStartIndex = kNumberOfDeletedElementsIndex + 1;
-
   static const int kNextTableIndex = kNumberOfElementsIndex;
   static const int kRemovedHolesIndex = kHashTableStartIndex;
 
-  static const int kEntrySize = entrysize + 1;
-  static const int kChainOffset = entrysize;
-
   static const int kLoadFactor = 2;
   static const int kMaxCapacity =
       (FixedArray::kMaxLength - kHashTableStartIndex)
@@ -4363,7 +4381,6 @@ class OrderedHashMap:public OrderedHashTable<
     return get(EntryToIndex(entry) + kValueOffset);
   }
 
- private:
   static const int kValueOffset = 1;
 };
 
@@ -6198,7 +6215,15 @@ class Map: public HeapObject {
                                             int descriptor_number,
                                             Handle<Object> value);
 
-  static Handle<Map> Normalize(Handle<Map> map, PropertyNormalizationMode mode);
+  static Handle<Map> Normalize(Handle<Map> map, PropertyNormalizationMode mode,
+                               const char* reason);
+
+  // Returns the fast root map that objects with the given dictionary map are
+  // migrated to by JSObject::RecordDictionaryLoad. Objects re-adding the same
+  // properties in the same order share the transitions below it.
+  static Handle<Map> ReoptimizedRootMap(Handle<Map> dictionary_map);
+  static const int kReoptimizedMapCacheEntries = 64;
+  static const int kReoptimizedMapCacheLength = 2 * kReoptimizedMapCacheEntries;
 
   // Returns the constructor name (the name (possibly, inferred name) of the
   // function that was used to instantiate the object).
@@ -6392,6 +6417,8 @@ class Map: public HeapObject {
   // transitions to avoid an explosion in the number of maps for objects used as
   // dictionaries.
   inline bool TooManyFastProperties(StoreFromKeyed store_mode);
+  static const int kFastPropertiesSoftLimit = 12;
+  static const int kMaxFastProperties = 128;
   static Handle<Map> TransitionToDataProperty(Handle<Map> map,
                                               Handle<Name> name,
                                               Handle<Object> value,
@@ -6711,9 +6738,6 @@ class Map: public HeapObject {
                                             Handle<Object> prototype,
                                             Handle<Map> target_map);
 
-  static const int kFastPropertiesSoftLimit = 12;
-  static const int kMaxFastProperties = 128;
-
   DISALLOW_IMPLICIT_CONSTRUCTORS(Map);
 };
 
@@ -10623,6 +10647,10 @@ class ExecutableAccessorInfo: public AccessorInfo {
   DECL_ACCESSORS(getter, Object)
   DECL_ACCESSORS(setter, Object)
   DECL_ACCESSORS(data, Object)
+  // Load IC handler for receivers that hold this accessor themselves, shared
+  // by all maps and native contexts that use this info. Undefined until the
+  // first such handler is compiled.
+  DECL_ACCESSORS(load_handler, Object)
 
   DECLARE_CAST(ExecutableAccessorInfo)
 
@@ -10633,7 +10661,8 @@ class ExecutableAccessorInfo: public AccessorInfo {
   static const int kGetterOffset = AccessorInfo::kSize;
   static const int kSetterOffset = kGetterOffset + kPointerSize;
   static const int kDataOffset = kSetterOffset + kPointerSize;
-  static const int kSize = kDataOffset + kPointerSize;
+  static const int kLoadHandlerOffset = kDataOffset + kPointerSize;
+  static const int kSize = kLoadHandlerOffset + kPointerSize;
 
   inline void clear_setter();
 
@@ -15,9 +15,56 @@
 namespace v8 {
 namespace internal {
 
+void RecompilationQueue::Enqueue(OptimizedCompileJob* job, int profiler_ticks,
+                                 bool is_osr) {
+  DCHECK(!IsFull());
+  // The function is stuck in a loop, compile it before anything else.
+  int priority = is_osr ? kMaxInt : profiler_ticks;
+  Entry entry = { job, priority, sequence_++, base::TimeTicks::Now() };
+  // Sift the new entry up from the first free slot.
+  int index = length_++;
+  while (index > 0) {
+    int parent = (index - 1) / 2;
+    if (!HasPrecedence(entry, entries_[parent])) break;
+    entries_[index] = entries_[parent];
+    index = parent;
+  }
+  entries_[index] = entry;
+}
+
+
+OptimizedCompileJob* RecompilationQueue::Dequeue(base::TimeTicks* queued_at) {
+  if (length_ == 0) return NULL;
+  Entry top = entries_[0];
+  DCHECK_NE(NULL, top.job);
+  *queued_at = top.queued_at;
+
+  // Sift the last entry down from the root.
+  Entry last = entries_[--length_];
+  int index = 0;
+  while (true) {
+    int child = 2 * index + 1;
+    if (child >= length_) break;
+    if (child + 1 < length_ &&
+        HasPrecedence(entries_[child + 1], entries_[child])) {
+      child++;
+    }
+    if (!HasPrecedence(entries_[child], last)) break;
+    entries_[index] = entries_[child];
+    index = child;
+  }
+  if (length_ > 0) entries_[index] = last;
+  return top.job;
+}
+
+
 OptimizingCompilerThread::~OptimizingCompilerThread() {
-  DCHECK_EQ(0, input_queue_length_);
-  DeleteArray(input_queue_);
+  DCHECK_EQ(0, input_queue_.length());
+  for (int i = 0; i < num_threads_; i++) delete threads_[i];
+  DeleteArray(threads_);
+#ifdef DEBUG
+  DeleteArray(thread_ids_);
+#endif
   if (FLAG_concurrent_osr) {
 #ifdef DEBUG
     for (int i = 0; i < osr_buffer_capacity_; i++) {
@@ -29,10 +76,18 @@ OptimizingCompilerThread::~OptimizingCompilerThread() {
 }
 
 
+void OptimizingCompilerThread::Start() {
+  for (int i = 0; i < num_threads_; i++) threads_[i]->Start();
+}
+
+
 void OptimizingCompilerThread::Run() {
 #ifdef DEBUG
   { base::LockGuard<base::Mutex> lock_guard(&thread_id_mutex_);
-    thread_id_ = ThreadId::Current().ToInteger();
+    int i = 0;
+    while (thread_ids_[i] != 0) i++;
+    DCHECK_LT(i, num_threads_);
+    thread_ids_[i] = ThreadId::Current().ToInteger();
   }
 #endif
   Isolate::SetIsolateThreadLocals(isolate_, NULL);
@@ -56,18 +111,18 @@ void OptimizingCompilerThread::Run() {
         break;
       case STOP:
         if (FLAG_trace_concurrent_recompilation) {
-          time_spent_total_ = total_timer.Elapsed();
+          base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
+          time_spent_total_ += total_timer.Elapsed();
         }
+        // The thread is about to exit; hand back its cached zone segments.
+        ZoneSegmentPool::ReleaseThreadCache();
         stop_semaphore_.Signal();
         return;
       case FLUSH:
-        // The main thread is blocked, waiting for the stop semaphore.
-        { AllowHandleDereference allow_handle_dereference;
-          FlushInputQueue(true);
-        }
-        base::Release_Store(&stop_thread_,
-                            static_cast<base::AtomicWord>(CONTINUE));
+        // The main thread flushes the queues once every compiler thread has
+        // reached this point, and lets them resume afterwards.
         stop_semaphore_.Signal();
+        resume_semaphore_.Wait();
         // Return to start of consumer loop.
         continue;
     }
@@ -78,6 +133,7 @@ void OptimizingCompilerThread::Run() {
     CompileNext();
 
     if (FLAG_trace_concurrent_recompilation) {
+      base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
       time_spent_compiling_ += compiling_timer.Elapsed();
     }
   }
@@ -86,11 +142,9 @@ void OptimizingCompilerThread::Run() {
 
 OptimizedCompileJob* OptimizingCompilerThread::NextInput() {
   base::LockGuard<base::Mutex> access_input_queue_(&input_queue_mutex_);
-  if (input_queue_length_ == 0) return NULL;
-  OptimizedCompileJob* job = input_queue_[InputQueueIndex(0)];
-  DCHECK_NE(NULL, job);
-  input_queue_shift_ = InputQueueIndex(1);
-  input_queue_length_--;
+  base::TimeTicks queued_at;
+  OptimizedCompileJob* job = input_queue_.Dequeue(&queued_at);
+  if (job != NULL) job->set_time_queued(base::TimeTicks::Now() - queued_at);
   return job;
 }
 
@@ -107,7 +161,10 @@ void OptimizingCompilerThread::CompileNext() {
   // The function may have already been optimized by OSR.  Simply continue.
   // Use a mutex to make sure that functions marked for install
   // are always also queued.
-  output_queue_.Enqueue(job);
+  {
+    base::LockGuard<base::Mutex> access_output_queue(&output_queue_mutex_);
+    output_queue_.Enqueue(job);
+  }
   isolate_->stack_guard()->RequestInstallCode();
 }
 
@@ -172,8 +229,12 @@ void OptimizingCompilerThread::Flush() {
   DCHECK(!IsOptimizerThread());
   base::Release_Store(&stop_thread_, static_cast<base::AtomicWord>(FLUSH));
   if (FLAG_block_concurrent_recompilation) Unblock();
-  input_queue_semaphore_.Signal();
-  stop_semaphore_.Wait();
+  for (int i = 0; i < num_threads_; i++) input_queue_semaphore_.Signal();
+  for (int i = 0; i < num_threads_; i++) stop_semaphore_.Wait();
+  // No compiler thread is working on a job now.
+  FlushInputQueue(true);
+  base::Release_Store(&stop_thread_, static_cast<base::AtomicWord>(CONTINUE));
+  for (int i = 0; i < num_threads_; i++) resume_semaphore_.Signal();
   FlushOutputQueue(true);
   if (FLAG_concurrent_osr) FlushOsrBuffer(true);
   if (FLAG_trace_concurrent_recompilation) {
@@ -186,13 +247,13 @@ void OptimizingCompilerThread::Stop() {
   DCHECK(!IsOptimizerThread());
   base::Release_Store(&stop_thread_, static_cast<base::AtomicWord>(STOP));
   if (FLAG_block_concurrent_recompilation) Unblock();
-  input_queue_semaphore_.Signal();
-  stop_semaphore_.Wait();
+  for (int i = 0; i < num_threads_; i++) input_queue_semaphore_.Signal();
+  for (int i = 0; i < num_threads_; i++) stop_semaphore_.Wait();
 
   if (FLAG_concurrent_recompilation_delay != 0) {
-    // At this point the optimizing compiler thread's event loop has stopped.
-    // There is no need for a mutex when reading input_queue_length_.
-    while (input_queue_length_ > 0) CompileNext();
+    // At this point the compiler threads' event loops have stopped.
+    // There is no need for a mutex when reading the input queue length.
+    while (input_queue_.length() > 0) CompileNext();
     InstallOptimizedFunctions();
   } else {
     FlushInputQueue(false);
@@ -203,7 +264,7 @@ void OptimizingCompilerThread::Stop() {
 
   if (FLAG_trace_concurrent_recompilation) {
     double percentage = time_spent_compiling_.PercentOf(time_spent_total_);
-    PrintF("  ** Compiler thread did %.2f%% useful work\n", percentage);
+    PrintF("  ** Compiler threads did %.2f%% useful work\n", percentage);
   }
 
   if ((FLAG_trace_osr || FLAG_trace_concurrent_recompilation) &&
@@ -211,7 +272,7 @@ void OptimizingCompilerThread::Stop() {
     PrintF("[COSR hit rate %d / %d]\n", osr_hits_, osr_attempts_);
   }
 
-  Join();
+  for (int i = 0; i < num_threads_; i++) threads_[i]->Join();
 }
 
 
@@ -221,6 +282,8 @@ void OptimizingCompilerThread::InstallOptimizedFunctions() {
 
   OptimizedCompileJob* job;
   while (output_queue_.Dequeue(&job)) {
+    isolate_->counters()->concurrent_recompilation_queue_wait_in_ms()
+        ->AddSample(static_cast<int>(job->time_queued().InMilliseconds()));
     CompilationInfo* info = job->info();
     Handle<JSFunction> function(*info->closure());
     if (info->is_osr()) {
@@ -248,26 +311,19 @@ void OptimizingCompilerThread::InstallOptimizedFunctions() {
 }
 
 
-void OptimizingCompilerThread::QueueForOptimization(OptimizedCompileJob* job) {
+void OptimizingCompilerThread::QueueForOptimization(OptimizedCompileJob* job,
+                                                    int priority) {
   DCHECK(IsQueueAvailable());
   DCHECK(!IsOptimizerThread());
   CompilationInfo* info = job->info();
   if (info->is_osr()) {
     osr_attempts_++;
     AddToOsrBuffer(job);
-    // Add job to the front of the input queue.
-    base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    // Move shift_ back by one.
-    input_queue_shift_ = InputQueueIndex(input_queue_capacity_ - 1);
-    input_queue_[InputQueueIndex(0)] = job;
-    input_queue_length_++;
-  } else {
-    // Add job to the back of the input queue.
+  }
+  isolate_->counters()->concurrent_recompilation_queued()->Increment();
+  {
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
-    DCHECK_LT(input_queue_length_, input_queue_capacity_);
-    input_queue_[InputQueueIndex(input_queue_length_)] = job;
-    input_queue_length_++;
+    input_queue_.Enqueue(job, priority, info->is_osr());
   }
   if (FLAG_block_concurrent_recompilation) {
     blocked_jobs_++;
@@ -364,7 +420,11 @@ bool OptimizingCompilerThread::IsOptimizerThread(Isolate* isolate) {
 
 bool OptimizingCompilerThread::IsOptimizerThread() {
   base::LockGuard<base::Mutex> lock_guard(&thread_id_mutex_);
-  return ThreadId::Current().ToInteger() == thread_id_;
+  int current = ThreadId::Current().ToInteger();
+  for (int i = 0; i < num_threads_; i++) {
+    if (thread_ids_[i] == current) return true;
+  }
+  return false;
 }
 #endif
 
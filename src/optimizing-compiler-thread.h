@@ -20,19 +20,60 @@ class HOptimizedGraphBuilder;
 class OptimizedCompileJob;
 class SharedFunctionInfo;
 
-class OptimizingCompilerThread : public base::Thread {
+// The input queue of concurrent recompilation, a bounded binary max-heap.
+// OSR jobs come first, other jobs are ordered by the profiler ticks of their
+// function, and equal priorities are served in queueing order. Not
+// synchronized; OptimizingCompilerThread guards it with a mutex.
+class RecompilationQueue {
+ public:
+  explicit RecompilationQueue(int capacity)
+      : entries_(NewArray<Entry>(capacity)),
+        capacity_(capacity),
+        length_(0),
+        sequence_(0) {}
+
+  ~RecompilationQueue() { DeleteArray(entries_); }
+
+  int length() const { return length_; }
+  bool IsFull() const { return length_ == capacity_; }
+
+  void Enqueue(OptimizedCompileJob* job, int profiler_ticks, bool is_osr);
+
+  // Removes the job with the highest priority and returns it, or NULL if the
+  // queue is empty. {queued_at} is set to the time the job was enqueued.
+  OptimizedCompileJob* Dequeue(base::TimeTicks* queued_at);
+
+ private:
+  struct Entry {
+    OptimizedCompileJob* job;
+    int priority;
+    unsigned sequence;
+    base::TimeTicks queued_at;
+  };
+
+  static inline bool HasPrecedence(const Entry& a, const Entry& b) {
+    if (a.priority != b.priority) return a.priority > b.priority;
+    // Sequence numbers may wrap around, compare their distance instead.
+    return static_cast<int>(a.sequence - b.sequence) < 0;
+  }
+
+  Entry* entries_;
+  int capacity_;
+  int length_;
+  unsigned sequence_;
+
+  DISALLOW_COPY_AND_ASSIGN(RecompilationQueue);
+};
+
+class OptimizingCompilerThread {
  public:
   explicit OptimizingCompilerThread(Isolate* isolate)
-      : Thread(Options("OptimizingCompilerThread")),
-#ifdef DEBUG
-        thread_id_(0),
-#endif
-        isolate_(isolate),
+      : isolate_(isolate),
+        num_threads_(NumberOfThreads()),
         stop_semaphore_(0),
+        resume_semaphore_(0),
         input_queue_semaphore_(0),
-        input_queue_capacity_(FLAG_concurrent_recompilation_queue_length),
-        input_queue_length_(0),
-        input_queue_shift_(0),
+        input_queue_(FLAG_concurrent_recompilation_queue_length),
         osr_buffer_capacity_(FLAG_concurrent_recompilation_queue_length + 4),
         osr_buffer_cursor_(0),
         osr_hits_(0),
@@ -40,7 +81,14 @@ class OptimizingCompilerThread : public base::Thread {
         blocked_jobs_(0) {
     base::NoBarrier_Store(&stop_thread_,
                           static_cast<base::AtomicWord>(CONTINUE));
-    input_queue_ = NewArray<OptimizedCompileJob*>(input_queue_capacity_);
+    threads_ = NewArray<CompilerThread*>(num_threads_);
+    for (int i = 0; i < num_threads_; i++) {
+      threads_[i] = new CompilerThread(this);
+    }
+#ifdef DEBUG
+    thread_ids_ = NewArray<int>(num_threads_);
+    for (int i = 0; i < num_threads_; i++) thread_ids_[i] = 0;
+#endif
     if (FLAG_concurrent_osr) {
       // Allocate and mark OSR buffer slots as empty.
       osr_buffer_ = NewArray<OptimizedCompileJob*>(osr_buffer_capacity_);
@@ -50,10 +98,15 @@ class OptimizingCompilerThread : public base::Thread {
 
   ~OptimizingCompilerThread();
 
+  // Starts the compiler threads. Each of them runs Run().
+  void Start();
   void Run();
   void Stop();
   void Flush();
-  void QueueForOptimization(OptimizedCompileJob* optimizing_compiler);
+  // Jobs with a higher priority are compiled first. OSR jobs go before all
+  // other jobs, equal priorities are served in queueing order.
+  void QueueForOptimization(OptimizedCompileJob* optimizing_compiler,
+                            int priority);
   void Unblock();
   void InstallOptimizedFunctions();
   OptimizedCompileJob* FindReadyOSRCandidate(Handle<JSFunction> function,
@@ -64,7 +117,7 @@ class OptimizingCompilerThread : public base::Thread {
 
   inline bool IsQueueAvailable() {
     base::LockGuard<base::Mutex> access_input_queue(&input_queue_mutex_);
-    return input_queue_length_ < input_queue_capacity_;
+    return !input_queue_.IsFull();
   }
 
   inline void AgeBufferedOsrJobs() {
@@ -86,6 +139,25 @@ class OptimizingCompilerThread : public base::Thread {
  private:
   enum StopFlag { CONTINUE, STOP, FLUSH };
 
+  class CompilerThread : public base::Thread {
+   public:
+    explicit CompilerThread(OptimizingCompilerThread* dispatcher)
+        : Thread(Options("OptimizingCompilerThread")),
+          dispatcher_(dispatcher) {}
+
+    virtual void Run() { dispatcher_->Run(); }
+
+   private:
+    OptimizingCompilerThread* dispatcher_;
+  };
+
+  // The hydrogen and TurboFan traces are not synchronized, so they limit
+  // concurrent recompilation to a single compiler thread.
+  static int NumberOfThreads() {
+    if (FLAG_trace_hydrogen || FLAG_trace_turbo) return 1;
+    return Max(1, FLAG_concurrent_recompilation_threads);
+  }
+
   void FlushInputQueue(bool restore_function_code);
   void FlushOutputQueue(bool restore_function_code);
   void FlushOsrBuffer(bool restore_function_code);
@@ -96,31 +168,27 @@ class OptimizingCompilerThread : public base::Thread {
   // Tasks evicted from the cyclic buffer are discarded.
   void AddToOsrBuffer(OptimizedCompileJob* compiler);
 
-  inline int InputQueueIndex(int i) {
-    int result = (i + input_queue_shift_) % input_queue_capacity_;
-    DCHECK_LE(0, result);
-    DCHECK_LT(result, input_queue_capacity_);
-    return result;
-  }
-
 #ifdef DEBUG
-  int thread_id_;
+  int* thread_ids_;
   base::Mutex thread_id_mutex_;
 #endif
 
   Isolate* isolate_;
+  CompilerThread** threads_;
+  int num_threads_;
   base::Semaphore stop_semaphore_;
+  base::Semaphore resume_semaphore_;
   base::Semaphore input_queue_semaphore_;
 
-  // Circular queue of incoming recompilation tasks (including OSR).
-  OptimizedCompileJob** input_queue_;
-  int input_queue_capacity_;
-  int input_queue_length_;
-  int input_queue_shift_;
+  // Priority queue of incoming recompilation tasks (including OSR).
+  RecompilationQueue input_queue_;
   base::Mutex input_queue_mutex_;
 
   // Queue of recompilation tasks ready to be installed (excluding OSR).
+  // The queue only supports a single producer, so the compiler threads
+  // enqueue under output_queue_mutex_. Only the main thread dequeues.
   UnboundQueue<OptimizedCompileJob*> output_queue_;
+  base::Mutex output_queue_mutex_;
 
   // Cyclic buffer of recompilation tasks for OSR.
   OptimizedCompileJob** osr_buffer_;
@@ -128,6 +196,7 @@ class OptimizingCompilerThread : public base::Thread {
   int osr_buffer_cursor_;
 
   volatile base::AtomicWord stop_thread_;
+  // Summed up over all compiler threads, guarded by input_queue_mutex_.
   base::TimeDelta time_spent_compiling_;
   base::TimeDelta time_spent_total_;
 
@@ -790,6 +790,7 @@ FunctionLiteral* Parser::ParseProgram() {
   if (FLAG_trace_parse) {
     timer.Start();
   }
+  unsigned zone_start_allocation_size = zone()->allocation_size();
   fni_ = new(zone()) FuncNameInferrer(ast_value_factory_, zone());
 
   // Initialize parser state.
@@ -811,6 +812,15 @@ FunctionLiteral* Parser::ParseProgram() {
         Handle<ExternalTwoByteString>::cast(source), 0, source->length());
     scanner_.Initialize(&stream);
     result = DoParseProgram(info(), source);
+  } else if (source->IsExternalAsciiString()) {
+    ExternalOneByteStringUtf16CharacterStream stream(
+        Handle<ExternalAsciiString>::cast(source), 0, source->length());
+    scanner_.Initialize(&stream);
+    result = DoParseProgram(info(), source);
+  } else if (source->IsOneByteRepresentation()) {
+    OneByteStringUtf16CharacterStream stream(source, 0, source->length());
+    scanner_.Initialize(&stream);
+    result = DoParseProgram(info(), source);
   } else {
     GenericStringUtf16CharacterStream stream(source, 0, source->length());
     scanner_.Initialize(&stream);
@@ -818,6 +828,10 @@ FunctionLiteral* Parser::ParseProgram() {
   }
   HandleSourceURLComments();
 
+  if (result != NULL) {
+    RecordAstSize("script", source->length(),
+                  zone()->allocation_size() - zone_start_allocation_size);
+  }
   if (FLAG_trace_parse && result != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
     if (info()->is_eval()) {
@@ -937,6 +951,7 @@ FunctionLiteral* Parser::ParseLazy() {
     timer.Start();
   }
   Handle<SharedFunctionInfo> shared_info = info()->shared_info();
+  unsigned zone_start_allocation_size = zone()->allocation_size();
 
   // Initialize parser state.
   source = String::Flatten(source);
@@ -947,6 +962,17 @@ FunctionLiteral* Parser::ParseLazy() {
         shared_info->start_position(),
         shared_info->end_position());
     result = ParseLazy(&stream);
+  } else if (source->IsExternalAsciiString()) {
+    ExternalOneByteStringUtf16CharacterStream stream(
+        Handle<ExternalAsciiString>::cast(source),
+        shared_info->start_position(),
+        shared_info->end_position());
+    result = ParseLazy(&stream);
+  } else if (source->IsOneByteRepresentation()) {
+    OneByteStringUtf16CharacterStream stream(source,
+                                             shared_info->start_position(),
+                                             shared_info->end_position());
+    result = ParseLazy(&stream);
   } else {
     GenericStringUtf16CharacterStream stream(source,
                                              shared_info->start_position(),
@@ -954,6 +980,11 @@ FunctionLiteral* Parser::ParseLazy() {
     result = ParseLazy(&stream);
   }
 
+  if (result != NULL) {
+    RecordAstSize("function",
+                  shared_info->end_position() - shared_info->start_position(),
+                  zone()->allocation_size() - zone_start_allocation_size);
+  }
   if (FLAG_trace_parse && result != NULL) {
     double ms = timer.Elapsed().InMillisecondsF();
     SmartArrayPointer<char> name_chars = result->debug_name()->ToCString();
@@ -963,6 +994,20 @@ FunctionLiteral* Parser::ParseLazy() {
 }
 
 
+void Parser::RecordAstSize(const char* kind, int source_size,
+                           unsigned ast_size) {
+  isolate()->counters()->total_ast_size()->Increment(ast_size);
+  if (!FLAG_trace_ast_size) return;
+  PrintF("[AST of %s: %u bytes for %d characters of source", kind, ast_size,
+         source_size);
+  if (source_size > 0) {
+    PrintF(", %0.2f bytes per character",
+           static_cast<double>(ast_size) / source_size);
+  }
+  PrintF("]\n");
+}
+
+
 FunctionLiteral* Parser::ParseLazy(Utf16CharacterStream* source) {
   Handle<SharedFunctionInfo> shared_info = info()->shared_info();
   scanner_.Initialize(source);
@@ -4824,6 +4869,9 @@ bool RegExpParser::ParseRegExp(FlatStringReader* input,
 
 bool Parser::Parse() {
   DCHECK(info()->function() == NULL);
+  CompilationStatistics::PhaseScope stats(
+      isolate(), info()->zone(), CompilationStatistics::PARSER,
+      info()->is_lazy() ? "parse lazy" : "parse");
   FunctionLiteral* result = NULL;
   pre_parse_timer_ = isolate()->counters()->pre_parse();
   if (FLAG_trace_parse || allow_natives_syntax() || extension_ != NULL) {
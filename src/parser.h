@@ -807,6 +807,10 @@ class Parser : public ParserBase<ParserTraits> {
 
   void HandleSourceURLComments();
 
+  // Accounts for the zone memory allocated for an AST of |source_size|
+  // characters and reports it if --trace-ast-size is on.
+  void RecordAstSize(const char* kind, int source_size, unsigned ast_size);
+
   void ThrowPendingError();
 
   // Handle errors detected during parsing, move statistics to Isolate,
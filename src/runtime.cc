@@ -3,6 +3,7 @@
 // found in the LICENSE file.
 
 #include <stdlib.h>
+#include <algorithm>
 #include <limits>
 
 #include "src/v8.h"
@@ -250,8 +251,8 @@ MUST_USE_RESULT static MaybeHandle<Object> CreateObjectLiteralBoilerplate(
   bool should_normalize = should_transform || has_function_literal;
   if (should_normalize) {
     // TODO(verwaest): We might not want to ever normalize here.
-    JSObject::NormalizeProperties(
-        boilerplate, KEEP_INOBJECT_PROPERTIES, length / 2);
+    JSObject::NormalizeProperties(boilerplate, KEEP_INOBJECT_PROPERTIES,
+                                  length / 2, "Boilerplate");
   }
   // TODO(verwaest): Support tracking representations in the boilerplate.
   for (int index = 0; index < length; index +=2) {
@@ -1030,9 +1031,130 @@ RUNTIME_FUNCTION(Runtime_TypedArrayInitialize) {
 }
 
 
+// Converts |length| elements of type SourceType at |source| to the element
+// type of TargetTraits at |target|, applying the same conversions as
+// storing the elements one by one.  The ranges must not overlap.
+template <class TargetTraits, typename SourceType>
+static void ConvertTypedArrayElements(void* target,
+                                      const void* source,
+                                      size_t length) {
+  typedef FixedTypedArray<TargetTraits> Target;
+  typename Target::ElementType* dst =
+      static_cast<typename Target::ElementType*>(target);
+  const SourceType* src = static_cast<const SourceType*>(source);
+  for (size_t i = 0; i < length; i++) {
+    dst[i] = Target::from_double(static_cast<double>(src[i]));
+  }
+}
+
+
+template <class TargetTraits>
+static void ConvertTypedArrayElementsTo(void* target,
+                                        ExternalArrayType source_type,
+                                        const void* source,
+                                        size_t length) {
+  switch (source_type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                      \
+    case kExternal##Type##Array:                                             \
+      ConvertTypedArrayElements<TargetTraits, ctype>(target, source, length);\
+      break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+}
+
+
+static void ConvertTypedArrayElements(ExternalArrayType target_type,
+                                      void* target,
+                                      ExternalArrayType source_type,
+                                      const void* source,
+                                      size_t length) {
+  switch (target_type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                      \
+    case kExternal##Type##Array:                                             \
+      ConvertTypedArrayElementsTo<Type##ArrayTraits>(                        \
+          target, source_type, source, length);                              \
+      break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+}
+
+
+// Returns true if the first |length| elements of |array| are Smis or doubles
+// stored in place, so that they can be read without looking at the
+// prototype chain.
+static bool HasFastNumberElements(JSArray* array, size_t length) {
+  DisallowHeapAllocation no_gc;
+  ElementsKind kind = array->GetElementsKind();
+  if (!IsFastSmiElementsKind(kind) && !IsFastDoubleElementsKind(kind)) {
+    return false;
+  }
+  if (!array->length()->IsSmi() ||
+      static_cast<size_t>(Smi::cast(array->length())->value()) != length ||
+      static_cast<size_t>(array->elements()->length()) < length) {
+    return false;
+  }
+  if (IsFastPackedElementsKind(kind)) return true;
+  for (size_t i = 0; i < length; i++) {
+    int index = static_cast<int>(i);
+    bool is_hole = IsFastDoubleElementsKind(kind)
+        ? FixedDoubleArray::cast(array->elements())->is_the_hole(index)
+        : FixedArray::cast(array->elements())->is_the_hole(index);
+    if (is_hole) return false;
+  }
+  return true;
+}
+
+
+template <class TargetTraits>
+static void ConvertFastNumberElementsTo(void* target,
+                                        JSArray* source,
+                                        size_t length) {
+  typedef FixedTypedArray<TargetTraits> Target;
+  DisallowHeapAllocation no_gc;
+  typename Target::ElementType* dst =
+      static_cast<typename Target::ElementType*>(target);
+  if (source->HasFastDoubleElements()) {
+    FixedDoubleArray* elements = FixedDoubleArray::cast(source->elements());
+    for (size_t i = 0; i < length; i++) {
+      dst[i] = Target::from_double(elements->get_scalar(static_cast<int>(i)));
+    }
+  } else {
+    FixedArray* elements = FixedArray::cast(source->elements());
+    for (size_t i = 0; i < length; i++) {
+      dst[i] = Target::from_int(
+          Smi::cast(elements->get(static_cast<int>(i)))->value());
+    }
+  }
+}
+
+
+// Converts the elements of a fast mode array for which HasFastNumberElements
+// holds to the elements of a typed array.
+static void ConvertFastNumberElements(ExternalArrayType target_type,
+                                      void* target,
+                                      JSArray* source,
+                                      size_t length) {
+  switch (target_type) {
+#define TYPED_ARRAY_CASE(Type, type, TYPE, ctype, size)                      \
+    case kExternal##Type##Array:                                             \
+      ConvertFastNumberElementsTo<Type##ArrayTraits>(target, source, length);\
+      break;
+
+    TYPED_ARRAYS(TYPED_ARRAY_CASE)
+#undef TYPED_ARRAY_CASE
+  }
+}
+
+
 // Initializes a typed array from an array-like object.
 // If an array-like object happens to be a typed array of the same type,
-// initializes backing store using memove.
+// initializes backing store using memove.  Typed arrays of other types and
+// fast mode arrays of numbers are converted element by element without
+// going back to JavaScript.
 //
 // Returns true if backing store was initialized or false otherwise.
 RUNTIME_FUNCTION(Runtime_TypedArrayInitializeFromArrayLike) {
@@ -1136,6 +1258,24 @@ RUNTIME_FUNCTION(Runtime_TypedArrayInitializeFromArrayLike) {
           byte_length);
       return isolate->heap()->true_value();
     }
+
+    // The length passed in was read from the array-like, which can differ
+    // from the real length if the length getter was replaced.
+    if (NumberToSize(isolate, typed_array->length()) == length) {
+      uint8_t* backing_store =
+          static_cast<uint8_t*>(typed_array->GetBuffer()->backing_store());
+      size_t source_byte_offset =
+          NumberToSize(isolate, typed_array->byte_offset());
+      ConvertTypedArrayElements(array_type, buffer->backing_store(),
+                                typed_array->type(),
+                                backing_store + source_byte_offset, length);
+      return isolate->heap()->true_value();
+    }
+  } else if (source->IsJSArray() &&
+             HasFastNumberElements(JSArray::cast(*source), length)) {
+    ConvertFastNumberElements(array_type, buffer->backing_store(),
+                              JSArray::cast(*source), length);
+    return isolate->heap()->true_value();
   }
 
   return isolate->heap()->false_value();
@@ -1168,15 +1308,11 @@ RUNTIME_FUNCTION(Runtime_TypedArrayGetBuffer) {
 // Return codes for Runtime_TypedArraySetFastCases.
 // Should be synchronized with typedarray.js natives.
 enum TypedArraySetResultCodes {
-  // Set from typed array of the same type.
-  // This is processed by TypedArraySetFastCases
-  TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE = 0,
-  // Set from typed array of the different type, overlapping in memory.
-  TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING = 1,
-  // Set from typed array of the different type, non-overlapping.
-  TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING = 2,
-  // Set from non-typed array.
-  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 3
+  // Set from a typed array or from a fast mode array of numbers.
+  // This is processed by TypedArraySetFastCases.
+  TYPED_ARRAY_SET_DONE = 0,
+  // Set from any other object.
+  TYPED_ARRAY_SET_NON_TYPED_ARRAY = 1
 };
 
 
@@ -1189,18 +1325,38 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
         NewTypeError("not_typed_array", HandleVector<Object>(NULL, 0)));
   }
 
-  if (!args[1]->IsJSTypedArray())
-    return Smi::FromInt(TYPED_ARRAY_SET_NON_TYPED_ARRAY);
-
-  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, target_obj, 0);
-  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, source_obj, 1);
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, target, 0);
   CONVERT_NUMBER_ARG_HANDLE_CHECKED(offset_obj, 2);
-
-  Handle<JSTypedArray> target(JSTypedArray::cast(*target_obj));
-  Handle<JSTypedArray> source(JSTypedArray::cast(*source_obj));
   size_t offset = 0;
   RUNTIME_ASSERT(TryNumberToSize(isolate, *offset_obj, &offset));
   size_t target_length = NumberToSize(isolate, target->length());
+  size_t target_offset = NumberToSize(isolate, target->byte_offset());
+
+  if (args[1]->IsJSArray()) {
+    // Fast mode arrays of numbers are converted here.  Anything else,
+    // including the range check, is left to JavaScript.
+    Handle<JSArray> source = args.at<JSArray>(1);
+    if (!source->length()->IsSmi()) {
+      return Smi::FromInt(TYPED_ARRAY_SET_NON_TYPED_ARRAY);
+    }
+    size_t source_length = Smi::cast(source->length())->value();
+    if (offset > target_length || source_length > target_length - offset ||
+        !HasFastNumberElements(*source, source_length)) {
+      return Smi::FromInt(TYPED_ARRAY_SET_NON_TYPED_ARRAY);
+    }
+    uint8_t* target_base =
+        static_cast<uint8_t*>(
+          target->GetBuffer()->backing_store()) + target_offset;
+    ConvertFastNumberElements(target->type(),
+                              target_base + offset * target->element_size(),
+                              *source, source_length);
+    return Smi::FromInt(TYPED_ARRAY_SET_DONE);
+  }
+
+  if (!args[1]->IsJSTypedArray())
+    return Smi::FromInt(TYPED_ARRAY_SET_NON_TYPED_ARRAY);
+
+  CONVERT_ARG_HANDLE_CHECKED(JSTypedArray, source, 1);
   size_t source_length = NumberToSize(isolate, source->length());
   size_t target_byte_length = NumberToSize(isolate, target->byte_length());
   size_t source_byte_length = NumberToSize(isolate, source->byte_length());
@@ -1211,7 +1367,6 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
                                HandleVector<Object>(NULL, 0)));
   }
 
-  size_t target_offset = NumberToSize(isolate, target->byte_offset());
   size_t source_offset = NumberToSize(isolate, source->byte_offset());
   uint8_t* target_base =
       static_cast<uint8_t*>(
@@ -1224,10 +1379,11 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
   if (target->type() == source->type()) {
     memmove(target_base + offset * target->element_size(),
         source_base, source_byte_length);
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_SAME_TYPE);
+    return Smi::FromInt(TYPED_ARRAY_SET_DONE);
   }
 
-  // Typed arrays of different types over the same backing store
+  // Typed arrays of different types over the same backing store are
+  // converted from a copy of the source elements.
   if ((source_base <= target_base &&
         source_base + source_byte_length > target_base) ||
       (target_base <= source_base &&
@@ -1236,10 +1392,17 @@ RUNTIME_FUNCTION(Runtime_TypedArraySetFastCases) {
     DCHECK(
       target->GetBuffer()->backing_store() ==
       source->GetBuffer()->backing_store());
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_OVERLAPPING);
+    ScopedVector<uint8_t> copy(static_cast<int>(source_byte_length));
+    memcpy(copy.start(), source_base, source_byte_length);
+    ConvertTypedArrayElements(target->type(),
+                              target_base + offset * target->element_size(),
+                              source->type(), copy.start(), source_length);
   } else {  // Non-overlapping typed arrays
-    return Smi::FromInt(TYPED_ARRAY_SET_TYPED_ARRAY_NONOVERLAPPING);
+    ConvertTypedArrayElements(target->type(),
+                              target_base + offset * target->element_size(),
+                              source->type(), source_base, source_length);
   }
+  return Smi::FromInt(TYPED_ARRAY_SET_DONE);
 }
 
 
@@ -2490,7 +2653,8 @@ RUNTIME_FUNCTION(Runtime_OptimizeObjectForAddingMultipleProperties) {
   // Conservative upper limit to prevent fuzz tests from going OOM.
   RUNTIME_ASSERT(properties <= 100000);
   if (object->HasFastProperties() && !object->IsJSGlobalProxy()) {
-    JSObject::NormalizeProperties(object, KEEP_INOBJECT_PROPERTIES, properties);
+    JSObject::NormalizeProperties(object, KEEP_INOBJECT_PROPERTIES, properties,
+                                  "OptimizeForAdding");
   }
   return *object;
 }
@@ -7565,19 +7729,14 @@ RUNTIME_FUNCTION(Runtime_NumberCompare) {
 
 // Compare two Smis as if they were converted to strings and then
 // compared lexicographically.
-RUNTIME_FUNCTION(Runtime_SmiLexicographicCompare) {
-  SealHandleScope shs(isolate);
-  DCHECK(args.length() == 2);
-  CONVERT_SMI_ARG_CHECKED(x_value, 0);
-  CONVERT_SMI_ARG_CHECKED(y_value, 1);
-
+static int SmiLexicographicCompare(int x_value, int y_value) {
   // If the integers are equal so are the string representations.
-  if (x_value == y_value) return Smi::FromInt(EQUAL);
+  if (x_value == y_value) return EQUAL;
 
   // If one of the integers is zero the normal integer order is the
   // same as the lexicographic order of the string representations.
   if (x_value == 0 || y_value == 0)
-    return Smi::FromInt(x_value < y_value ? LESS : GREATER);
+    return x_value < y_value ? LESS : GREATER;
 
   // If only one of the integers is negative the negative number is
   // smallest because the char code of '-' is less than the char code
@@ -7588,8 +7747,8 @@ RUNTIME_FUNCTION(Runtime_SmiLexicographicCompare) {
   uint32_t x_scaled = x_value;
   uint32_t y_scaled = y_value;
   if (x_value < 0 || y_value < 0) {
-    if (y_value >= 0) return Smi::FromInt(LESS);
-    if (x_value >= 0) return Smi::FromInt(GREATER);
+    if (y_value >= 0) return LESS;
+    if (x_value >= 0) return GREATER;
     x_scaled = -x_value;
     y_scaled = -y_value;
   }
@@ -7634,50 +7793,35 @@ RUNTIME_FUNCTION(Runtime_SmiLexicographicCompare) {
     tie = GREATER;
   }
 
-  if (x_scaled < y_scaled) return Smi::FromInt(LESS);
-  if (x_scaled > y_scaled) return Smi::FromInt(GREATER);
-  return Smi::FromInt(tie);
+  if (x_scaled < y_scaled) return LESS;
+  if (x_scaled > y_scaled) return GREATER;
+  return tie;
 }
 
 
-RUNTIME_FUNCTION(Runtime_StringCompare) {
-  HandleScope handle_scope(isolate);
+RUNTIME_FUNCTION(Runtime_SmiLexicographicCompare) {
+  SealHandleScope shs(isolate);
   DCHECK(args.length() == 2);
+  CONVERT_SMI_ARG_CHECKED(x_value, 0);
+  CONVERT_SMI_ARG_CHECKED(y_value, 1);
+  return Smi::FromInt(SmiLexicographicCompare(x_value, y_value));
+}
 
-  CONVERT_ARG_HANDLE_CHECKED(String, x, 0);
-  CONVERT_ARG_HANDLE_CHECKED(String, y, 1);
-
-  isolate->counters()->string_compare_runtime()->Increment();
-
-  // A few fast case tests before we flatten.
-  if (x.is_identical_to(y)) return Smi::FromInt(EQUAL);
-  if (y->length() == 0) {
-    if (x->length() == 0) return Smi::FromInt(EQUAL);
-    return Smi::FromInt(GREATER);
-  } else if (x->length() == 0) {
-    return Smi::FromInt(LESS);
-  }
-
-  int d = x->Get(0) - y->Get(0);
-  if (d < 0) return Smi::FromInt(LESS);
-  else if (d > 0) return Smi::FromInt(GREATER);
-
-  // Slow case.
-  x = String::Flatten(x);
-  y = String::Flatten(y);
 
-  DisallowHeapAllocation no_gc;
-  Object* equal_prefix_result = Smi::FromInt(EQUAL);
+// Compares two flattened strings by their code units.
+static int CompareFlatStrings(String* x, String* y) {
+  int equal_prefix_result = EQUAL;
   int prefix_length = x->length();
   if (y->length() < prefix_length) {
     prefix_length = y->length();
-    equal_prefix_result = Smi::FromInt(GREATER);
+    equal_prefix_result = GREATER;
   } else if (y->length() > prefix_length) {
-    equal_prefix_result = Smi::FromInt(LESS);
+    equal_prefix_result = LESS;
   }
   int r;
   String::FlatContent x_content = x->GetFlatContent();
   String::FlatContent y_content = y->GetFlatContent();
+  DCHECK(x_content.IsFlat() && y_content.IsFlat());
   if (x_content.IsAscii()) {
     Vector<const uint8_t> x_chars = x_content.ToOneByteVector();
     if (y_content.IsAscii()) {
@@ -7697,13 +7841,39 @@ RUNTIME_FUNCTION(Runtime_StringCompare) {
       r = CompareChars(x_chars.start(), y_chars.start(), prefix_length);
     }
   }
-  Object* result;
-  if (r == 0) {
-    result = equal_prefix_result;
-  } else {
-    result = (r < 0) ? Smi::FromInt(LESS) : Smi::FromInt(GREATER);
+  if (r == 0) return equal_prefix_result;
+  return (r < 0) ? LESS : GREATER;
+}
+
+
+RUNTIME_FUNCTION(Runtime_StringCompare) {
+  HandleScope handle_scope(isolate);
+  DCHECK(args.length() == 2);
+
+  CONVERT_ARG_HANDLE_CHECKED(String, x, 0);
+  CONVERT_ARG_HANDLE_CHECKED(String, y, 1);
+
+  isolate->counters()->string_compare_runtime()->Increment();
+
+  // A few fast case tests before we flatten.
+  if (x.is_identical_to(y)) return Smi::FromInt(EQUAL);
+  if (y->length() == 0) {
+    if (x->length() == 0) return Smi::FromInt(EQUAL);
+    return Smi::FromInt(GREATER);
+  } else if (x->length() == 0) {
+    return Smi::FromInt(LESS);
   }
-  return result;
+
+  int d = x->Get(0) - y->Get(0);
+  if (d < 0) return Smi::FromInt(LESS);
+  else if (d > 0) return Smi::FromInt(GREATER);
+
+  // Slow case.
+  x = String::Flatten(x);
+  y = String::Flatten(y);
+
+  DisallowHeapAllocation no_gc;
+  return Smi::FromInt(CompareFlatStrings(*x, *y));
 }
 
 
@@ -10727,6 +10897,187 @@ RUNTIME_FUNCTION(Runtime_RemoveArrayHoles) {
 }
 
 
+namespace {
+
+struct SmiLexicographicLess {
+  bool operator()(Object* a, Object* b) const {
+    return SmiLexicographicCompare(Smi::cast(a)->value(),
+                                   Smi::cast(b)->value()) < 0;
+  }
+};
+
+
+struct FlatStringLess {
+  bool operator()(Object* a, Object* b) const {
+    return CompareFlatStrings(String::cast(a), String::cast(b)) < 0;
+  }
+};
+
+
+// Orders indices into a list of zero terminated strings.
+struct CStringIndexLess {
+  CStringIndexLess(const char* chars, const int* offsets)
+      : chars_(chars), offsets_(offsets) {}
+  bool operator()(int a, int b) const {
+    return strcmp(chars_ + offsets_[a], chars_ + offsets_[b]) < 0;
+  }
+  const char* chars_;
+  const int* offsets_;
+};
+
+}  // namespace
+
+
+static void SortFastDoubleElements(FixedDoubleArray* elements,
+                                   uint32_t length) {
+  // Compare the string representations once instead of converting both
+  // numbers on every comparison.
+  List<char> chars;
+  List<int> offsets(length);
+  char buffer[kDoubleToCStringMinBufferSize];
+  for (uint32_t i = 0; i < length; i++) {
+    const char* str = DoubleToCString(elements->get_scalar(i),
+                                      Vector<char>(buffer, arraysize(buffer)));
+    offsets.Add(chars.length());
+    chars.AddAll(Vector<char>(const_cast<char*>(str), StrLength(str) + 1));
+  }
+  ScopedVector<int> order(length);
+  for (uint32_t i = 0; i < length; i++) order[i] = i;
+  std::stable_sort(order.start(), order.start() + length,
+                   CStringIndexLess(chars.ToConstVector().start(),
+                                    offsets.ToConstVector().start()));
+  ScopedVector<double> values(length);
+  for (uint32_t i = 0; i < length; i++) {
+    values[i] = elements->get_scalar(order[i]);
+  }
+  for (uint32_t i = 0; i < length; i++) elements->set(i, values[i]);
+}
+
+
+// Sorts the first |length| elements of a fast mode array in the order of
+// the default comparator of Array.prototype.sort, i.e. by their string
+// representations.  Only arrays whose elements in that range are all Smis,
+// all doubles or all strings are handled.  Returns false without touching
+// the array otherwise, and the caller has to fall back to the JavaScript
+// implementation.
+RUNTIME_FUNCTION(Runtime_SortFastElements) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 2);
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+  CONVERT_NUMBER_CHECKED(uint32_t, length, Uint32, args[1]);
+  if (array->map()->is_observed()) return isolate->heap()->false_value();
+  ElementsKind kind = array->GetElementsKind();
+  if (length > static_cast<uint32_t>(array->elements()->length())) {
+    return isolate->heap()->false_value();
+  }
+  if (length < 2) {
+    return isolate->heap()->ToBoolean(IsFastElementsKind(kind));
+  }
+
+  if (IsFastDoubleElementsKind(kind)) {
+    if (array->elements()->map() != isolate->heap()->fixed_double_array_map()) {
+      return isolate->heap()->false_value();
+    }
+    DisallowHeapAllocation no_gc;
+    FixedDoubleArray* elements = FixedDoubleArray::cast(array->elements());
+    for (uint32_t i = 0; i < length; i++) {
+      if (elements->is_the_hole(i)) return isolate->heap()->false_value();
+    }
+    SortFastDoubleElements(elements, length);
+    return isolate->heap()->true_value();
+  }
+
+  if (!IsFastSmiOrObjectElementsKind(kind)) {
+    return isolate->heap()->false_value();
+  }
+
+  bool all_smis = true;
+  bool all_strings = true;
+  {
+    DisallowHeapAllocation no_gc;
+    FixedArray* elements = FixedArray::cast(array->elements());
+    for (uint32_t i = 0; i < length && (all_smis || all_strings); i++) {
+      Object* element = elements->get(i);
+      if (!element->IsSmi()) all_smis = false;
+      if (!element->IsString()) all_strings = false;
+    }
+  }
+  if (!all_smis && !all_strings) return isolate->heap()->false_value();
+
+  Handle<FixedArray> elements = JSObject::EnsureWritableFastElements(array);
+  if (all_strings) {
+    // Flattening may allocate, so it is done for all strings before any raw
+    // pointers are taken.  Flattened cons strings can be read in place.
+    for (uint32_t i = 0; i < length; i++) {
+      String::Flatten(handle(String::cast(elements->get(i)), isolate));
+    }
+  }
+
+  DisallowHeapAllocation no_gc;
+  ScopedVector<Object*> values(length);
+  for (uint32_t i = 0; i < length; i++) values[i] = elements->get(i);
+  if (all_smis) {
+    std::stable_sort(values.start(), values.start() + length,
+                     SmiLexicographicLess());
+    for (uint32_t i = 0; i < length; i++) {
+      elements->set(i, values[i], SKIP_WRITE_BARRIER);
+    }
+  } else {
+    std::stable_sort(values.start(), values.start() + length,
+                     FlatStringLess());
+    WriteBarrierMode mode = elements->GetWriteBarrierMode(no_gc);
+    for (uint32_t i = 0; i < length; i++) elements->set(i, values[i], mode);
+  }
+  return isolate->heap()->true_value();
+}
+
+
+// Stores a value into the elements of a fast mode array in the range
+// [start, end) in one go.  Returns false without touching the array if that
+// could be observed, and the caller has to store the elements one by one.
+RUNTIME_FUNCTION(Runtime_FillFastElements) {
+  HandleScope scope(isolate);
+  DCHECK(args.length() == 4);
+  CONVERT_ARG_HANDLE_CHECKED(JSArray, array, 0);
+  CONVERT_ARG_HANDLE_CHECKED(Object, value, 1);
+  CONVERT_NUMBER_CHECKED(uint32_t, start, Uint32, args[2]);
+  CONVERT_NUMBER_CHECKED(uint32_t, end, Uint32, args[3]);
+  // Filling holes adds elements, which must not run setters on the
+  // prototype chain or fail on non-extensible arrays.
+  if (!array->HasFastElements() ||
+      array->map()->is_observed() ||
+      !array->map()->is_extensible() ||
+      array->map()->DictionaryElementsInPrototypeChainOnly()) {
+    return isolate->heap()->false_value();
+  }
+  uint32_t length = static_cast<uint32_t>(Smi::cast(array->length())->value());
+  if (start > end || end > length ||
+      end > static_cast<uint32_t>(array->elements()->length())) {
+    return isolate->heap()->false_value();
+  }
+  if (start == end) return isolate->heap()->true_value();
+
+  ElementsKind kind = array->GetElementsKind();
+  ElementsKind target_kind = kind;
+  if (value->IsHeapNumber()) {
+    if (IsFastSmiElementsKind(kind)) target_kind = FAST_DOUBLE_ELEMENTS;
+  } else if (!value->IsSmi()) {
+    target_kind = FAST_ELEMENTS;
+  }
+  if (IsFastHoleyElementsKind(kind)) {
+    target_kind = GetHoleyElementsKind(target_kind);
+  }
+  if (target_kind != kind) JSObject::TransitionElementsKind(array, target_kind);
+
+  Handle<FixedArrayBase> elements(array->elements(), isolate);
+  if (IsFastSmiOrObjectElementsKind(target_kind)) {
+    elements = JSObject::EnsureWritableFastElements(array);
+  }
+  array->GetElementsAccessor()->Fill(elements, value, start, end);
+  return isolate->heap()->true_value();
+}
+
+
 // Move contents of argument 0 (an array) to argument 1 (an array)
 RUNTIME_FUNCTION(Runtime_MoveArrayContents) {
   HandleScope scope(isolate);
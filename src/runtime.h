@@ -246,6 +246,8 @@ namespace internal {
                                                                       \
   /* Arrays */                                                        \
   F(RemoveArrayHoles, 2, 1)                                           \
+  F(SortFastElements, 2, 1)                                           \
+  F(FillFastElements, 4, 1)                                           \
   F(GetArrayKeys, 2, 1)                                               \
   F(MoveArrayContents, 2, 1)                                          \
   F(EstimateNumberOfElements, 1, 1)                                   \
@@ -283,7 +285,6 @@ namespace internal {
   /* Harmony sets */                                                  \
   F(SetInitialize, 1, 1)                                              \
   F(SetAdd, 2, 1)                                                     \
-  F(SetHas, 2, 1)                                                     \
   F(SetDelete, 2, 1)                                                  \
   F(SetClear, 1, 1)                                                   \
   F(SetGetSize, 1, 1)                                                 \
@@ -293,8 +294,6 @@ namespace internal {
                                                                       \
   /* Harmony maps */                                                  \
   F(MapInitialize, 1, 1)                                              \
-  F(MapGet, 2, 1)                                                     \
-  F(MapHas, 2, 1)                                                     \
   F(MapDelete, 2, 1)                                                  \
   F(MapClear, 1, 1)                                                   \
   F(MapSet, 3, 1)                                                     \
@@ -704,7 +703,11 @@ namespace internal {
   F(DoubleHi, 1, 1)                                                          \
   F(DoubleLo, 1, 1)                                                          \
   F(MathSqrtRT, 1, 1)                                                        \
-  F(MathLogRT, 1, 1)
+  F(MathLogRT, 1, 1)                                                         \
+  /* ES6 Collections */                                                      \
+  F(MapGet, 2, 1)                                                            \
+  F(MapHas, 2, 1)                                                            \
+  F(SetHas, 2, 1)
 
 
 //---------------------------------------------------------------------------
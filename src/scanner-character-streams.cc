@@ -129,6 +129,64 @@ unsigned GenericStringUtf16CharacterStream::FillBuffer(unsigned from_pos) {
 }
 
 
+// ----------------------------------------------------------------------------
+// OneByteStringUtf16CharacterStream
+
+
+OneByteStringUtf16CharacterStream::OneByteStringUtf16CharacterStream(
+    Handle<String> data,
+    unsigned start_position,
+    unsigned end_position)
+    : Utf16CharacterStream(),
+      string_(data),
+      length_(end_position) {
+  DCHECK(data->IsOneByteRepresentation());
+  DCHECK(end_position >= start_position);
+  pos_ = start_position;
+  // Initialize buffer as being empty. First read will fill the buffer.
+  one_byte_buffer_cursor_ = buffer_;
+  one_byte_buffer_end_ = buffer_;
+}
+
+
+OneByteStringUtf16CharacterStream::~OneByteStringUtf16CharacterStream() { }
+
+
+void OneByteStringUtf16CharacterStream::PushBack(uc32 character) {
+  pos_--;
+  if (character == kEndOfInput) return;
+  if (one_byte_buffer_cursor_ > buffer_) {
+    DCHECK(one_byte_buffer_cursor_[-1] == character);
+    one_byte_buffer_cursor_--;
+    return;
+  }
+  // The character was read from the previous block. The string is random
+  // access, so drop the buffer and let the next read start at pos_.
+  one_byte_buffer_end_ = buffer_;
+}
+
+
+bool OneByteStringUtf16CharacterStream::ReadBlock() {
+  one_byte_buffer_cursor_ = buffer_;
+  one_byte_buffer_end_ = buffer_;
+  if (pos_ >= length_) return false;
+  unsigned length = Min(kBufferSize, length_ - pos_);
+  String::WriteToFlat<uint8_t>(*string_, buffer_, pos_, pos_ + length);
+  one_byte_buffer_end_ = buffer_ + length;
+  return true;
+}
+
+
+unsigned OneByteStringUtf16CharacterStream::SlowSeekForward(unsigned delta) {
+  unsigned old_pos = pos_;
+  pos_ = Min(pos_ + delta, length_);
+  // The next read refills the buffer from the new position.
+  one_byte_buffer_cursor_ = buffer_;
+  one_byte_buffer_end_ = buffer_;
+  return pos_ - old_pos;
+}
+
+
 // ----------------------------------------------------------------------------
 // Utf8ToUtf16CharacterStream
 Utf8ToUtf16CharacterStream::Utf8ToUtf16CharacterStream(const byte* data,
@@ -296,4 +354,26 @@ ExternalTwoByteStringUtf16CharacterStream
   pos_ = start_position;
 }
 
+
+
+// ----------------------------------------------------------------------------
+// ExternalOneByteStringUtf16CharacterStream
+
+ExternalOneByteStringUtf16CharacterStream::
+    ~ExternalOneByteStringUtf16CharacterStream() { }
+
+
+ExternalOneByteStringUtf16CharacterStream
+    ::ExternalOneByteStringUtf16CharacterStream(
+        Handle<ExternalAsciiString> data,
+        int start_position,
+        int end_position)
+    : Utf16CharacterStream(),
+      source_(data),
+      raw_data_(data->GetChars() + start_position) {
+  one_byte_buffer_cursor_ = raw_data_;
+  one_byte_buffer_end_ = raw_data_ + (end_position - start_position);
+  pos_ = start_position;
+}
+
 } }  // namespace v8::internal
@@ -53,6 +53,30 @@ class GenericStringUtf16CharacterStream: public BufferedUtf16CharacterStream {
 };
 
 
+// Stream over a flat one-byte string. The characters are copied into a
+// one-byte buffer block by block, since the string may be moved by the GC,
+// but they are never widened to UTF-16.
+class OneByteStringUtf16CharacterStream: public Utf16CharacterStream {
+ public:
+  OneByteStringUtf16CharacterStream(Handle<String> data,
+                                    unsigned start_position,
+                                    unsigned end_position);
+  virtual ~OneByteStringUtf16CharacterStream();
+
+  virtual void PushBack(uc32 character);
+
+ protected:
+  static const unsigned kBufferSize = 1024;
+
+  virtual unsigned SlowSeekForward(unsigned delta);
+  virtual bool ReadBlock();
+
+  Handle<String> string_;
+  unsigned length_;
+  uint8_t buffer_[kBufferSize];
+};
+
+
 // Utf16 stream based on a literal UTF-8 string.
 class Utf8ToUtf16CharacterStream: public BufferedUtf16CharacterStream {
  public:
@@ -100,6 +124,42 @@ class ExternalTwoByteStringUtf16CharacterStream: public Utf16CharacterStream {
   const uc16* raw_data_;  // Pointer to the actual array of characters.
 };
 
+
+// One-byte buffer to read characters from an external one-byte string.
+class ExternalOneByteStringUtf16CharacterStream: public Utf16CharacterStream {
+ public:
+  ExternalOneByteStringUtf16CharacterStream(Handle<ExternalAsciiString> data,
+                                            int start_position,
+                                            int end_position);
+  virtual ~ExternalOneByteStringUtf16CharacterStream();
+
+  virtual void PushBack(uc32 character) {
+    if (character == kEndOfInput) {
+      pos_--;
+      return;
+    }
+    DCHECK(one_byte_buffer_cursor_ > raw_data_);
+    one_byte_buffer_cursor_--;
+    pos_--;
+  }
+
+ protected:
+  virtual unsigned SlowSeekForward(unsigned delta) {
+    // Seeking past the end of the string stops at the end.
+    unsigned remaining =
+        static_cast<unsigned>(one_byte_buffer_end_ - one_byte_buffer_cursor_);
+    one_byte_buffer_cursor_ = one_byte_buffer_end_;
+    pos_ += remaining;
+    return remaining;
+  }
+  virtual bool ReadBlock() {
+    // Entire string is read at start.
+    return false;
+  }
+  Handle<ExternalAsciiString> source_;
+  const uint8_t* raw_data_;  // Pointer to the actual array of characters.
+};
+
 } }  // namespace v8::internal
 
 #endif  // V8_SCANNER_CHARACTER_STREAMS_H_
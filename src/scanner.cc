@@ -16,6 +16,10 @@
 #include "src/parser.h"
 #include "src/scanner.h"
 
+#if V8_HOST_ARCH_X64
+#include <emmintrin.h>  // SSE2 is part of the x64 baseline.
+#endif
+
 namespace v8 {
 namespace internal {
 
@@ -28,6 +32,211 @@ Handle<String> LiteralBuffer::Internalize(Isolate* isolate) const {
 }
 
 
+// ----------------------------------------------------------------------------
+// Bulk scanning kernels
+//
+// A kernel returns the index of the first character in a run of buffered
+// input that the scanner has to look at individually, or the length of the
+// run if all of it can be consumed at once. Each matcher gives the scalar
+// definition of such a stop character; on x64 it also tests a 16 byte block
+// of one-byte characters or UTF-16 code units at a time with SSE2.
+
+#if V8_HOST_ARCH_X64
+
+template <typename Char>
+struct SimdOps;
+
+
+template <>
+struct SimdOps<uint8_t> {
+  static inline __m128i Splat(int c) {
+    return _mm_set1_epi8(static_cast<int8_t>(c));
+  }
+  static inline __m128i Equal(__m128i block, int c) {
+    return _mm_cmpeq_epi8(block, Splat(c));
+  }
+  // Selects the lanes that are greater than |limit| as unsigned values.
+  static inline __m128i UnsignedGreaterThan(__m128i block, int limit) {
+    if (limit >= 0xff) return _mm_setzero_si128();
+    const int kSignBit = 0x80;
+    return _mm_cmpgt_epi8(_mm_xor_si128(block, Splat(kSignBit)),
+                          Splat(limit ^ kSignBit));
+  }
+  // Selects the lanes in [from, to]. Both bounds must be ASCII.
+  static inline __m128i InRange(__m128i block, int from, int to) {
+    DCHECK(from > 0 && to < 0x7f);
+    return _mm_and_si128(_mm_cmpgt_epi8(block, Splat(from - 1)),
+                         _mm_cmplt_epi8(block, Splat(to + 1)));
+  }
+};
+
+
+template <>
+struct SimdOps<uint16_t> {
+  static inline __m128i Splat(int c) {
+    return _mm_set1_epi16(static_cast<int16_t>(c));
+  }
+  static inline __m128i Equal(__m128i block, int c) {
+    return _mm_cmpeq_epi16(block, Splat(c));
+  }
+  static inline __m128i UnsignedGreaterThan(__m128i block, int limit) {
+    const int kSignBit = 0x8000;
+    return _mm_cmpgt_epi16(_mm_xor_si128(block, Splat(kSignBit)),
+                           Splat(limit ^ kSignBit));
+  }
+  static inline __m128i InRange(__m128i block, int from, int to) {
+    DCHECK(from > 0 && to < 0x7f);
+    return _mm_and_si128(_mm_cmpgt_epi16(block, Splat(from - 1)),
+                         _mm_cmplt_epi16(block, Splat(to + 1)));
+  }
+};
+
+#endif  // V8_HOST_ARCH_X64
+
+
+template <typename Char, typename Matcher>
+static inline int FindFirstStop(Vector<const Char> chars,
+                                const Matcher& matcher) {
+  const Char* start = chars.start();
+  const int length = chars.length();
+  int i = 0;
+#if V8_HOST_ARCH_X64
+  const int kLanes = sizeof(__m128i) / sizeof(Char);
+  for (; i + kLanes <= length; i += kLanes) {
+    __m128i block =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + i));
+    // The mask has one bit per byte, i.e. sizeof(Char) bits per lane.
+    uint32_t mask = matcher.template StopMask<Char>(block);
+    if (mask != 0) {
+      return i + static_cast<int>(base::bits::CountTrailingZeros32(mask) /
+                                  sizeof(Char));
+    }
+  }
+#endif
+  for (; i < length; i++) {
+    if (matcher.IsStop(start[i])) break;
+  }
+  return i;
+}
+
+
+// Stops at anything but spaces and tabs, i.e. skips indentation.
+class BlankMatcher {
+ public:
+  bool IsStop(uc32 c) const { return c != ' ' && c != '\t'; }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  uint32_t StopMask(__m128i block) const {
+    typedef SimdOps<Char> Ops;
+    __m128i blank =
+        _mm_or_si128(Ops::Equal(block, ' '), Ops::Equal(block, '\t'));
+    return ~_mm_movemask_epi8(blank) & 0xffff;
+  }
+#endif
+};
+
+
+// Stops at characters that may be line terminators, and optionally at '*'
+// (for the text of multi-line comments).
+class CommentTextMatcher {
+ public:
+  explicit CommentTextMatcher(bool stop_at_star)
+      : stop_at_star_(stop_at_star) {}
+  bool IsStop(uc32 c) const {
+    return c == '\n' || c == '\r' || c >= 0x2028 ||
+           (stop_at_star_ && c == '*');
+  }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  uint32_t StopMask(__m128i block) const {
+    typedef SimdOps<Char> Ops;
+    __m128i stop =
+        _mm_or_si128(Ops::Equal(block, '\n'), Ops::Equal(block, '\r'));
+    stop = _mm_or_si128(stop, Ops::UnsignedGreaterThan(block, 0x2027));
+    if (stop_at_star_) stop = _mm_or_si128(stop, Ops::Equal(block, '*'));
+    return _mm_movemask_epi8(stop);
+  }
+#endif
+
+ private:
+  bool stop_at_star_;
+};
+
+
+// Stops at the closing quote, escapes, line terminators and non-ASCII
+// characters, so that everything before the stop is a verbatim ASCII part
+// of the string value.
+class StringTextMatcher {
+ public:
+  explicit StringTextMatcher(uc32 quote) : quote_(quote) {}
+  bool IsStop(uc32 c) const {
+    return c == quote_ || c == '\\' || c == '\n' || c == '\r' || c > 0x7f;
+  }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  uint32_t StopMask(__m128i block) const {
+    typedef SimdOps<Char> Ops;
+    __m128i stop =
+        _mm_or_si128(Ops::Equal(block, quote_), Ops::Equal(block, '\\'));
+    stop = _mm_or_si128(stop, Ops::Equal(block, '\n'));
+    stop = _mm_or_si128(stop, Ops::Equal(block, '\r'));
+    stop = _mm_or_si128(stop, Ops::UnsignedGreaterThan(block, 0x7f));
+    return _mm_movemask_epi8(stop);
+  }
+#endif
+
+ private:
+  uc32 quote_;
+};
+
+
+// Stops at anything that is not an ASCII identifier part. Escapes and
+// non-ASCII identifier parts are left to the slow path.
+class IdentifierPartMatcher {
+ public:
+  bool IsStop(uc32 c) const {
+    return !(IsInRange(AsciiAlphaToLower(c), 'a', 'z') ||
+             IsDecimalDigit(c) || c == '_' || c == '$');
+  }
+#if V8_HOST_ARCH_X64
+  template <typename Char>
+  uint32_t StopMask(__m128i block) const {
+    typedef SimdOps<Char> Ops;
+    __m128i lower = _mm_or_si128(block, Ops::Splat(0x20));
+    __m128i part = _mm_or_si128(Ops::InRange(lower, 'a', 'z'),
+                                Ops::InRange(block, '0', '9'));
+    part = _mm_or_si128(part, Ops::Equal(block, '_'));
+    part = _mm_or_si128(part, Ops::Equal(block, '$'));
+    return ~_mm_movemask_epi8(part) & 0xffff;
+  }
+#endif
+};
+
+
+template <typename Matcher>
+int Scanner::CountBufferedInput(const Matcher& matcher) {
+  Vector<const uint8_t> one_byte_chars = source_->buffered_one_byte_chars();
+  if (one_byte_chars.length() > 0) {
+    return FindFirstStop(one_byte_chars, matcher);
+  }
+  return FindFirstStop(source_->buffered_code_units(), matcher);
+}
+
+
+void Scanner::AddBufferedLiteralChars(int count) {
+  DCHECK_NOT_NULL(next_.literal_chars);
+  if (count == 0) return;
+  Vector<const uint8_t> one_byte_chars = source_->buffered_one_byte_chars();
+  if (one_byte_chars.length() > 0) {
+    next_.literal_chars->AddOneByteChars(one_byte_chars.start(), count);
+  } else {
+    next_.literal_chars->AddOneByteChars(
+        source_->buffered_code_units().start(), count);
+  }
+  source_->SeekForward(count);
+}
+
+
 // ----------------------------------------------------------------------------
 // Scanner
 
@@ -258,6 +467,8 @@ bool Scanner::SkipWhiteSpace() {
       // Remember if the latter is the case.
       if (unicode_cache_->IsLineTerminator(c0_)) {
         has_line_terminator_before_next_ = true;
+      } else if (c0_ == ' ' || c0_ == '\t') {
+        SkipBufferedInput(CountBufferedInput(BlankMatcher()));
       } else if (!unicode_cache_->IsWhiteSpace(c0_) &&
                  !IsLittleEndianByteOrderMark(c0_)) {
         break;
@@ -298,6 +509,7 @@ Token::Value Scanner::SkipSingleLineComment() {
   // stream of input elements for the syntactic grammar (see
   // ECMA-262, section 7.4).
   while (c0_ >= 0 && !unicode_cache_->IsLineTerminator(c0_)) {
+    SkipBufferedInput(CountBufferedInput(CommentTextMatcher(false)));
     Advance();
   }
 
@@ -373,6 +585,10 @@ Token::Value Scanner::SkipMultiLineComment() {
 
   while (c0_ >= 0) {
     uc32 ch = c0_;
+    if (ch != '*' && !unicode_cache_->IsLineTerminator(ch)) {
+      // Nothing up to the next '*' or line terminator affects the result.
+      SkipBufferedInput(CountBufferedInput(CommentTextMatcher(true)));
+    }
     Advance();
     if (unicode_cache_->IsLineTerminator(ch)) {
       // Following ECMA-262, section 7.4, a comment containing
@@ -762,11 +978,13 @@ Token::Value Scanner::ScanString() {
   while (c0_ != quote && c0_ >= 0
          && !unicode_cache_->IsLineTerminator(c0_)) {
     uc32 c = c0_;
-    Advance();
     if (c == '\\') {
+      Advance();
       if (c0_ < 0 || !ScanEscape()) return Token::ILLEGAL;
     } else {
       AddLiteralChar(c);
+      AddBufferedLiteralChars(CountBufferedInput(StringTextMatcher(quote)));
+      Advance();
     }
   }
   if (c0_ != quote) return Token::ILLEGAL;
@@ -901,72 +1119,153 @@ uc32 Scanner::ScanIdentifierUnicodeEscape() {
 
 // ----------------------------------------------------------------------------
 // Keyword Matcher
+//
+// Keywords are looked up in a perfect hash table keyed on the length and
+// the first two characters of the identifier, so that a single comparison
+// decides whether an identifier is a keyword. The constants and the table
+// below are generated by tools/gen-keyword-table.py.
+
+struct KeywordTableEntry {
+  const char* keyword;
+  int length;
+  Token::Value token;
+};
 
-#define KEYWORDS(KEYWORD_GROUP, KEYWORD)                                      \
-  KEYWORD_GROUP('b')                                                          \
-  KEYWORD("break", Token::BREAK)                                              \
-  KEYWORD_GROUP('c')                                                          \
-  KEYWORD("case", Token::CASE)                                                \
-  KEYWORD("catch", Token::CATCH)                                              \
-  KEYWORD("class", Token::FUTURE_RESERVED_WORD)                               \
-  KEYWORD("const", Token::CONST)                                              \
-  KEYWORD("continue", Token::CONTINUE)                                        \
-  KEYWORD_GROUP('d')                                                          \
-  KEYWORD("debugger", Token::DEBUGGER)                                        \
-  KEYWORD("default", Token::DEFAULT)                                          \
-  KEYWORD("delete", Token::DELETE)                                            \
-  KEYWORD("do", Token::DO)                                                    \
-  KEYWORD_GROUP('e')                                                          \
-  KEYWORD("else", Token::ELSE)                                                \
-  KEYWORD("enum", Token::FUTURE_RESERVED_WORD)                                \
-  KEYWORD("export",                                                           \
-          harmony_modules ? Token::EXPORT : Token::FUTURE_RESERVED_WORD)      \
-  KEYWORD("extends", Token::FUTURE_RESERVED_WORD)                             \
-  KEYWORD_GROUP('f')                                                          \
-  KEYWORD("false", Token::FALSE_LITERAL)                                      \
-  KEYWORD("finally", Token::FINALLY)                                          \
-  KEYWORD("for", Token::FOR)                                                  \
-  KEYWORD("function", Token::FUNCTION)                                        \
-  KEYWORD_GROUP('i')                                                          \
-  KEYWORD("if", Token::IF)                                                    \
-  KEYWORD("implements", Token::FUTURE_STRICT_RESERVED_WORD)                   \
-  KEYWORD("import",                                                           \
-          harmony_modules ? Token::IMPORT : Token::FUTURE_RESERVED_WORD)      \
-  KEYWORD("in", Token::IN)                                                    \
-  KEYWORD("instanceof", Token::INSTANCEOF)                                    \
-  KEYWORD("interface", Token::FUTURE_STRICT_RESERVED_WORD)                    \
-  KEYWORD_GROUP('l')                                                          \
-  KEYWORD("let",                                                              \
-          harmony_scoping ? Token::LET : Token::FUTURE_STRICT_RESERVED_WORD)  \
-  KEYWORD_GROUP('n')                                                          \
-  KEYWORD("new", Token::NEW)                                                  \
-  KEYWORD("null", Token::NULL_LITERAL)                                        \
-  KEYWORD_GROUP('p')                                                          \
-  KEYWORD("package", Token::FUTURE_STRICT_RESERVED_WORD)                      \
-  KEYWORD("private", Token::FUTURE_STRICT_RESERVED_WORD)                      \
-  KEYWORD("protected", Token::FUTURE_STRICT_RESERVED_WORD)                    \
-  KEYWORD("public", Token::FUTURE_STRICT_RESERVED_WORD)                       \
-  KEYWORD_GROUP('r')                                                          \
-  KEYWORD("return", Token::RETURN)                                            \
-  KEYWORD_GROUP('s')                                                          \
-  KEYWORD("static", Token::FUTURE_STRICT_RESERVED_WORD)                       \
-  KEYWORD("super",                                                            \
-          harmony_classes ? Token::SUPER : Token::FUTURE_RESERVED_WORD)       \
-  KEYWORD("switch", Token::SWITCH)                                            \
-  KEYWORD_GROUP('t')                                                          \
-  KEYWORD("this", Token::THIS)                                                \
-  KEYWORD("throw", Token::THROW)                                              \
-  KEYWORD("true", Token::TRUE_LITERAL)                                        \
-  KEYWORD("try", Token::TRY)                                                  \
-  KEYWORD("typeof", Token::TYPEOF)                                            \
-  KEYWORD_GROUP('v')                                                          \
-  KEYWORD("var", Token::VAR)                                                  \
-  KEYWORD("void", Token::VOID)                                                \
-  KEYWORD_GROUP('w')                                                          \
-  KEYWORD("while", Token::WHILE)                                              \
-  KEYWORD("with", Token::WITH)                                                \
-  KEYWORD_GROUP('y')                                                          \
-  KEYWORD("yield", Token::YIELD)
+
+static const int kKeywordTableSize = 128;
+static const int kKeywordLengthFactor = 22;
+static const int kKeywordFirstCharFactor = 61;
+
+static const KeywordTableEntry kKeywordTable[kKeywordTableSize] = {
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "null", 4, Token::NULL_LITERAL },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "export", 6, Token::EXPORT },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "return", 6, Token::RETURN },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "if", 2, Token::IF },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "with", 4, Token::WITH },
+  { "false", 5, Token::FALSE_LITERAL },
+  { NULL, 0, Token::IDENTIFIER },
+  { "in", 2, Token::IN },
+  { NULL, 0, Token::IDENTIFIER },
+  { "typeof", 6, Token::TYPEOF },
+  { NULL, 0, Token::IDENTIFIER },
+  { "extends", 7, Token::FUTURE_RESERVED_WORD },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "public", 6, Token::FUTURE_STRICT_RESERVED_WORD },
+  { NULL, 0, Token::IDENTIFIER },
+  { "package", 7, Token::FUTURE_STRICT_RESERVED_WORD },
+  { "yield", 5, Token::YIELD },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "while", 5, Token::WHILE },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "continue", 8, Token::CONTINUE },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "interface", 9, Token::FUTURE_STRICT_RESERVED_WORD },
+  { "break", 5, Token::BREAK },
+  { NULL, 0, Token::IDENTIFIER },
+  { "private", 7, Token::FUTURE_STRICT_RESERVED_WORD },
+  { "delete", 6, Token::DELETE },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "var", 3, Token::VAR },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "super", 5, Token::SUPER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "implements", 10, Token::FUTURE_STRICT_RESERVED_WORD },
+  { "instanceof", 10, Token::INSTANCEOF },
+  { "case", 4, Token::CASE },
+  { "finally", 7, Token::FINALLY },
+  { NULL, 0, Token::IDENTIFIER },
+  { "default", 7, Token::DEFAULT },
+  { NULL, 0, Token::IDENTIFIER },
+  { "else", 4, Token::ELSE },
+  { NULL, 0, Token::IDENTIFIER },
+  { "enum", 4, Token::FUTURE_RESERVED_WORD },
+  { "try", 3, Token::TRY },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "new", 3, Token::NEW },
+  { NULL, 0, Token::IDENTIFIER },
+  { "static", 6, Token::FUTURE_STRICT_RESERVED_WORD },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "switch", 6, Token::SWITCH },
+  { "let", 3, Token::LET },
+  { "this", 4, Token::THIS },
+  { "void", 4, Token::VOID },
+  { "catch", 5, Token::CATCH },
+  { NULL, 0, Token::IDENTIFIER },
+  { "protected", 9, Token::FUTURE_STRICT_RESERVED_WORD },
+  { "debugger", 8, Token::DEBUGGER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "true", 4, Token::TRUE_LITERAL },
+  { "do", 2, Token::DO },
+  { NULL, 0, Token::IDENTIFIER },
+  { "class", 5, Token::FUTURE_RESERVED_WORD },
+  { NULL, 0, Token::IDENTIFIER },
+  { "function", 8, Token::FUNCTION },
+  { "const", 5, Token::CONST },
+  { NULL, 0, Token::IDENTIFIER },
+  { "import", 6, Token::IMPORT },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "throw", 5, Token::THROW },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { NULL, 0, Token::IDENTIFIER },
+  { "for", 3, Token::FOR },
+};
 
 
 static Token::Value KeywordOrIdentifierToken(const uint8_t* input,
@@ -980,34 +1279,25 @@ static Token::Value KeywordOrIdentifierToken(const uint8_t* input,
   if (input_length < kMinLength || input_length > kMaxLength) {
     return Token::IDENTIFIER;
   }
-  switch (input[0]) {
+  int hash = input_length * kKeywordLengthFactor +
+             input[0] * kKeywordFirstCharFactor + input[1];
+  const KeywordTableEntry& entry =
+      kKeywordTable[hash & (kKeywordTableSize - 1)];
+  if (entry.length != input_length ||
+      memcmp(entry.keyword, input, input_length) != 0) {
+    return Token::IDENTIFIER;
+  }
+  switch (entry.token) {
+    case Token::EXPORT:
+    case Token::IMPORT:
+      return harmony_modules ? entry.token : Token::FUTURE_RESERVED_WORD;
+    case Token::LET:
+      return harmony_scoping ? entry.token : Token::FUTURE_STRICT_RESERVED_WORD;
+    case Token::SUPER:
+      return harmony_classes ? entry.token : Token::FUTURE_RESERVED_WORD;
     default:
-#define KEYWORD_GROUP_CASE(ch)                                \
-      break;                                                  \
-    case ch:
-#define KEYWORD(keyword, token)                               \
-    {                                                         \
-      /* 'keyword' is a char array, so sizeof(keyword) is */  \
-      /* strlen(keyword) plus 1 for the NUL char. */          \
-      const int keyword_length = sizeof(keyword) - 1;         \
-      STATIC_ASSERT(keyword_length >= kMinLength);            \
-      STATIC_ASSERT(keyword_length <= kMaxLength);            \
-      if (input_length == keyword_length &&                   \
-          input[1] == keyword[1] &&                           \
-          (keyword_length <= 2 || input[2] == keyword[2]) &&  \
-          (keyword_length <= 3 || input[3] == keyword[3]) &&  \
-          (keyword_length <= 4 || input[4] == keyword[4]) &&  \
-          (keyword_length <= 5 || input[5] == keyword[5]) &&  \
-          (keyword_length <= 6 || input[6] == keyword[6]) &&  \
-          (keyword_length <= 7 || input[7] == keyword[7]) &&  \
-          (keyword_length <= 8 || input[8] == keyword[8]) &&  \
-          (keyword_length <= 9 || input[9] == keyword[9])) {  \
-        return token;                                         \
-      }                                                       \
-    }
-    KEYWORDS(KEYWORD_GROUP_CASE, KEYWORD)
+      return entry.token;
   }
-  return Token::IDENTIFIER;
 }
 
 
@@ -1039,15 +1329,17 @@ Token::Value Scanner::ScanIdentifierOrKeyword() {
   }
 
   uc32 first_char = c0_;
-  Advance();
   AddLiteralChar(first_char);
+  AddBufferedLiteralChars(CountBufferedInput(IdentifierPartMatcher()));
+  Advance();
 
   // Scan the rest of the identifier characters.
   while (unicode_cache_->IsIdentifierPart(c0_)) {
     if (c0_ != '\\') {
       uc32 next_char = c0_;
-      Advance();
       AddLiteralChar(next_char);
+      AddBufferedLiteralChars(CountBufferedInput(IdentifierPartMatcher()));
+      Advance();
       continue;
     }
     // Fallthrough if no longer able to complete keyword.
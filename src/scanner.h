@@ -41,20 +41,36 @@ inline int HexValue(uc32 c) {
 // Buffered stream of UTF-16 code units, using an internal UTF-16 buffer.
 // A code unit is a 16 bit value representing either a 16 bit code point
 // or one part of a surrogate pair that make a single 21 bit code point.
+//
+// Streams over one-byte sources buffer Latin-1 characters instead, which
+// are valid UTF-16 code units on their own and are returned without
+// widening them into a UTF-16 buffer first. At most one of the two
+// buffers holds input at any time.
 
 class Utf16CharacterStream {
  public:
-  Utf16CharacterStream() : pos_(0) { }
+  Utf16CharacterStream()
+      : buffer_cursor_(NULL),
+        buffer_end_(NULL),
+        one_byte_buffer_cursor_(NULL),
+        one_byte_buffer_end_(NULL),
+        pos_(0) { }
   virtual ~Utf16CharacterStream() { }
 
   // Returns and advances past the next UTF-16 code unit in the input
   // stream. If there are no more code units, it returns a negative
   // value.
   inline uc32 Advance() {
-    if (buffer_cursor_ < buffer_end_ || ReadBlock()) {
-      pos_++;
-      return static_cast<uc32>(*(buffer_cursor_++));
-    }
+    do {
+      if (one_byte_buffer_cursor_ < one_byte_buffer_end_) {
+        pos_++;
+        return static_cast<uc32>(*(one_byte_buffer_cursor_++));
+      }
+      if (buffer_cursor_ < buffer_end_) {
+        pos_++;
+        return static_cast<uc32>(*(buffer_cursor_++));
+      }
+    } while (ReadBlock());
     // Note: currently the following increment is necessary to avoid a
     // parser problem! The scanner treats the final kEndOfInput as
     // a code unit with a position, and does math relative to that
@@ -80,9 +96,32 @@ class Utf16CharacterStream {
       pos_ += code_unit_count;
       return code_unit_count;
     }
+    unsigned buffered_one_byte_chars =
+        static_cast<unsigned>(one_byte_buffer_end_ - one_byte_buffer_cursor_);
+    if (code_unit_count <= buffered_one_byte_chars) {
+      one_byte_buffer_cursor_ += code_unit_count;
+      pos_ += code_unit_count;
+      return code_unit_count;
+    }
     return SlowSeekForward(code_unit_count);
   }
 
+  // Returns the UTF-16 code units that are already buffered after the
+  // current position, without reading a new block. The scanner's fast
+  // paths examine these in bulk and consume the ones they handle with
+  // SeekForward, which never leaves the buffer in that case.
+  inline Vector<const uint16_t> buffered_code_units() const {
+    return Vector<const uint16_t>(
+        buffer_cursor_, static_cast<int>(buffer_end_ - buffer_cursor_));
+  }
+
+  // Like buffered_code_units(), for streams over one-byte sources.
+  inline Vector<const uint8_t> buffered_one_byte_chars() const {
+    return Vector<const uint8_t>(
+        one_byte_buffer_cursor_,
+        static_cast<int>(one_byte_buffer_end_ - one_byte_buffer_cursor_));
+  }
+
   // Pushes back the most recently read UTF-16 code unit (or negative
   // value if at end of input), i.e., the value returned by the most recent
   // call to Advance.
@@ -92,15 +131,18 @@ class Utf16CharacterStream {
  protected:
   static const uc32 kEndOfInput = -1;
 
-  // Ensures that the buffer_cursor_ points to the code_unit at
-  // position pos_ of the input, if possible. If the position
-  // is at or after the end of the input, return false. If there
-  // are more code_units available, return true.
+  // Ensures that the buffer_cursor_ (or, for one-byte streams, the
+  // one_byte_buffer_cursor_) points to the code_unit at position pos_ of
+  // the input, if possible. If the position is at or after the end of the
+  // input, return false. If there are more code_units available, return
+  // true.
   virtual bool ReadBlock() = 0;
   virtual unsigned SlowSeekForward(unsigned code_unit_count) = 0;
 
   const uint16_t* buffer_cursor_;
   const uint16_t* buffer_end_;
+  const uint8_t* one_byte_buffer_cursor_;
+  const uint8_t* one_byte_buffer_end_;
   unsigned pos_;
 };
 
@@ -216,6 +258,19 @@ class LiteralBuffer {
     position_ += kUC16Size;
   }
 
+  // Adds a run of code units that are all in the Latin-1 range, as found
+  // by the scanner's fast paths.
+  template <typename Char>
+  void AddOneByteChars(const Char* chars, int length) {
+    if (!is_one_byte_) {
+      for (int i = 0; i < length; i++) AddChar(chars[i]);
+      return;
+    }
+    while (position_ + length > backing_store_.length()) ExpandBuffer();
+    CopyChars(backing_store_.start() + position_, chars, length);
+    position_ += length;
+  }
+
   bool is_one_byte() const { return is_one_byte_; }
 
   bool is_contextual_keyword(Vector<const char> keyword) const {
@@ -517,6 +572,23 @@ class Scanner {
     Advance();
   }
 
+  // Bulk scanning support. The fast paths below look at the input that is
+  // buffered behind c0_ and consume a whole run of it at once, so that the
+  // following Advance() returns the first code unit they did not handle.
+
+  // Returns the number of buffered code units before the first one the
+  // matcher stops at.
+  template <typename Matcher>
+  int CountBufferedInput(const Matcher& matcher);
+
+  inline void SkipBufferedInput(int count) {
+    if (count > 0) source_->SeekForward(count);
+  }
+
+  // Adds the first |count| buffered code units to the literal and skips
+  // them. They must all be one-byte characters.
+  void AddBufferedLiteralChars(int count);
+
   // Low-level scanning support.
   void Advance() { c0_ = source_->Advance(); }
   void PushBack(uc32 ch) {
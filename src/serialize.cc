@@ -391,6 +391,10 @@ void ExternalReferenceTable::PopulateTable(Isolate* isolate) {
       STUB_CACHE_TABLE, 5, "StubCache::secondary_->value");
   Add(stub_cache->map_reference(StubCache::kSecondary).address(),
       STUB_CACHE_TABLE, 6, "StubCache::secondary_->map");
+  Add(stub_cache->mask_reference(StubCache::kPrimary).address(),
+      STUB_CACHE_TABLE, 7, "StubCache::primary_mask_");
+  Add(stub_cache->mask_reference(StubCache::kSecondary).address(),
+      STUB_CACHE_TABLE, 8, "StubCache::secondary_mask_");
 
   // Runtime entries
   Add(ExternalReference::delete_handle_scope_extensions(isolate).address(),
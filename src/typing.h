@@ -49,10 +49,10 @@ class AstTyper: public AstVisitor {
   TypeFeedbackOracle* oracle() { return &oracle_; }
 
   void NarrowType(Expression* e, Bounds b) {
-    e->set_bounds(Bounds::Both(e->bounds(), b, zone()));
+    e->set_bounds(Bounds::Both(e->bounds(), b, zone()), zone());
   }
   void NarrowLowerType(Expression* e, Type* t) {
-    e->set_bounds(Bounds::NarrowLower(e->bounds(), t, zone()));
+    e->set_bounds(Bounds::NarrowLower(e->bounds(), t, zone()), zone());
   }
 
   Effects EnterEffects() {
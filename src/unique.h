@@ -98,6 +98,13 @@ class Unique {
     return handle_;
   }
 
+  // The address of the object when this unique was created. Moving
+  // collections may have relocated the object since.
+  inline Address raw_address() const {
+    DCHECK(IsInitialized());
+    return raw_address_;
+  }
+
   template <class S> static Unique<T> cast(Unique<S> that) {
     return Unique<T>(that.raw_address_, Handle<T>::cast(that.handle_));
   }
@@ -53,6 +53,7 @@ void V8::TearDown() {
   RegisteredExtension::UnregisterAll();
   Isolate::GlobalTearDown();
   Sampler::TearDown();
+  ZoneSegmentPool::TearDown();
   FlagList::ResetAllFlags();  // Frees memory held by string arguments.
 }
 
@@ -80,6 +81,7 @@ void V8::InitializeOncePerProcessImpl() {
   base::OS::Initialize(FLAG_random_seed, FLAG_hard_abort, FLAG_gc_fake_mmap);
 
   Sampler::SetUp();
+  ZoneSegmentPool::SetUp();
   CpuFeatures::Probe(false);
   init_memcopy_functions();
   // The custom exp implementation needs 16KB of lookup data; initialize it
@@ -32,6 +32,10 @@ bool Zone::excess_allocation() {
 void Zone::adjust_segment_bytes_allocated(int delta) {
   segment_bytes_allocated_ += delta;
   isolate_->counters()->zone_segment_bytes()->Set(segment_bytes_allocated_);
+  isolate_->counters()->zone_segment_pool_bytes_held()->Set(
+      static_cast<int>(ZoneSegmentPool::bytes_held()));
+  isolate_->counters()->zone_segment_pool_bytes_in_use()->Set(
+      static_cast<int>(ZoneSegmentPool::bytes_in_use()));
 }
 
 
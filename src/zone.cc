@@ -5,12 +5,226 @@
 #include <string.h>
 
 #include "src/v8.h"
+
+#include "src/base/atomicops.h"
+#include "src/base/platform/mutex.h"
+#include "src/base/platform/platform.h"
 #include "src/zone-inl.h"
 
 namespace v8 {
 namespace internal {
 
 
+// ----------------------------------------------------------------------------
+// ZoneSegmentPool
+
+// Unused segments are chained through their first word.
+struct FreeSegment {
+  FreeSegment* next;
+};
+
+
+// Size classes are the powers of two between the minimum and the maximum
+// pooled segment size.
+static const int kMinimumPooledSegmentSizeLog2 = 13;
+static const int kMaximumPooledSegmentSizeLog2 = 16;
+STATIC_ASSERT((1 << kMinimumPooledSegmentSizeLog2) ==
+              ZoneSegmentPool::kMinimumPooledSegmentSize);
+STATIC_ASSERT((1 << kMaximumPooledSegmentSizeLog2) ==
+              ZoneSegmentPool::kMaximumPooledSegmentSize);
+static const int kNumberOfSegmentSizeClasses =
+    kMaximumPooledSegmentSizeLog2 - kMinimumPooledSegmentSizeLog2 + 1;
+
+
+// The unused segments cached by one thread, at most one per size class.
+// The owning thread is the only one allocating from and freeing into the
+// cache, but ReleaseUnusedSegments can drain it from any thread.
+struct SegmentThreadCache {
+  base::Mutex mutex;
+  FreeSegment* segments[kNumberOfSegmentSizeClasses];
+  SegmentThreadCache* next;
+};
+
+
+static bool segment_pool_enabled = false;
+static base::Thread::LocalStorageKey segment_thread_cache_key;
+// Guards the shared free lists and the list of thread caches.
+static base::LazyMutex segment_pool_mutex = LAZY_MUTEX_INITIALIZER;
+static FreeSegment* free_segments[kNumberOfSegmentSizeClasses];
+static SegmentThreadCache* segment_thread_caches = NULL;
+static base::AtomicWord segment_bytes_held = 0;
+static base::AtomicWord segment_bytes_in_use = 0;
+
+
+static bool IsPooledSegmentSize(int size) {
+  return size >= ZoneSegmentPool::kMinimumPooledSegmentSize &&
+         size <= ZoneSegmentPool::kMaximumPooledSegmentSize &&
+         base::bits::IsPowerOfTwo32(size);
+}
+
+
+static int SegmentSizeClass(int size) {
+  DCHECK(IsPooledSegmentSize(size));
+  return WhichPowerOf2(size) - kMinimumPooledSegmentSizeLog2;
+}
+
+
+static int SegmentSize(int size_class) {
+  return ZoneSegmentPool::kMinimumPooledSegmentSize << size_class;
+}
+
+
+static SegmentThreadCache* GetSegmentThreadCache() {
+  SegmentThreadCache* cache = reinterpret_cast<SegmentThreadCache*>(
+      base::Thread::GetThreadLocal(segment_thread_cache_key));
+  if (cache == NULL) {
+    cache = new SegmentThreadCache();
+    for (int i = 0; i < kNumberOfSegmentSizeClasses; i++) {
+      cache->segments[i] = NULL;
+    }
+    base::LockGuard<base::Mutex> lock_guard(segment_pool_mutex.Pointer());
+    cache->next = segment_thread_caches;
+    segment_thread_caches = cache;
+    base::Thread::SetThreadLocal(segment_thread_cache_key, cache);
+  }
+  return cache;
+}
+
+
+// Frees the cached segments. The caller must hold the cache's mutex.
+static void ClearSegmentThreadCache(SegmentThreadCache* cache) {
+  for (int i = 0; i < kNumberOfSegmentSizeClasses; i++) {
+    if (cache->segments[i] == NULL) continue;
+    base::NoBarrier_AtomicIncrement(&segment_bytes_held, -SegmentSize(i));
+    Malloced::Delete(cache->segments[i]);
+    cache->segments[i] = NULL;
+  }
+}
+
+
+void ZoneSegmentPool::SetUp() {
+  DCHECK(!segment_pool_enabled);
+  segment_thread_cache_key = base::Thread::CreateThreadLocalKey();
+  segment_pool_enabled = true;
+}
+
+
+void ZoneSegmentPool::TearDown() {
+  if (!segment_pool_enabled) return;
+  ReleaseUnusedSegments();
+  segment_pool_enabled = false;
+  base::LockGuard<base::Mutex> lock_guard(segment_pool_mutex.Pointer());
+  while (segment_thread_caches != NULL) {
+    SegmentThreadCache* cache = segment_thread_caches;
+    segment_thread_caches = cache->next;
+    delete cache;
+  }
+  base::Thread::DeleteThreadLocalKey(segment_thread_cache_key);
+}
+
+
+int ZoneSegmentPool::RoundUpToSizeClass(int size) {
+  if (size > kMaximumPooledSegmentSize) return size;
+  return Max(kMinimumPooledSegmentSize,
+             static_cast<int>(base::bits::RoundUpToPowerOfTwo32(size)));
+}
+
+
+void* ZoneSegmentPool::Allocate(int size, bool* reused) {
+  DCHECK_EQ(RoundUpToSizeClass(size), size);
+  base::NoBarrier_AtomicIncrement(&segment_bytes_in_use, size);
+  *reused = false;
+  if (!segment_pool_enabled || !IsPooledSegmentSize(size)) {
+    return Malloced::New(size);
+  }
+  int size_class = SegmentSizeClass(size);
+  FreeSegment* segment = NULL;
+  SegmentThreadCache* cache = GetSegmentThreadCache();
+  {
+    base::LockGuard<base::Mutex> lock_guard(&cache->mutex);
+    segment = cache->segments[size_class];
+    cache->segments[size_class] = NULL;
+  }
+  if (segment == NULL) {
+    base::LockGuard<base::Mutex> lock_guard(segment_pool_mutex.Pointer());
+    segment = free_segments[size_class];
+    if (segment != NULL) free_segments[size_class] = segment->next;
+  }
+  if (segment == NULL) return Malloced::New(size);
+  base::NoBarrier_AtomicIncrement(&segment_bytes_held, -size);
+  *reused = true;
+  return segment;
+}
+
+
+void ZoneSegmentPool::Free(void* memory, int size) {
+  base::NoBarrier_AtomicIncrement(&segment_bytes_in_use, -size);
+  intptr_t budget = static_cast<intptr_t>(FLAG_zone_segment_pool_size) * MB;
+  if (!segment_pool_enabled || !IsPooledSegmentSize(size) ||
+      base::NoBarrier_Load(&segment_bytes_held) + size > budget) {
+    Malloced::Delete(memory);
+    return;
+  }
+  base::NoBarrier_AtomicIncrement(&segment_bytes_held, size);
+  int size_class = SegmentSizeClass(size);
+  FreeSegment* segment = reinterpret_cast<FreeSegment*>(memory);
+  SegmentThreadCache* cache = GetSegmentThreadCache();
+  {
+    base::LockGuard<base::Mutex> lock_guard(&cache->mutex);
+    if (cache->segments[size_class] == NULL) {
+      cache->segments[size_class] = segment;
+      return;
+    }
+  }
+  base::LockGuard<base::Mutex> lock_guard(segment_pool_mutex.Pointer());
+  segment->next = free_segments[size_class];
+  free_segments[size_class] = segment;
+}
+
+
+void ZoneSegmentPool::ReleaseThreadCache() {
+  if (!segment_pool_enabled) return;
+  SegmentThreadCache* cache = reinterpret_cast<SegmentThreadCache*>(
+      base::Thread::GetThreadLocal(segment_thread_cache_key));
+  if (cache == NULL) return;
+  base::LockGuard<base::Mutex> lock_guard(&cache->mutex);
+  ClearSegmentThreadCache(cache);
+}
+
+
+void ZoneSegmentPool::ReleaseUnusedSegments() {
+  if (!segment_pool_enabled) return;
+  base::LockGuard<base::Mutex> lock_guard(segment_pool_mutex.Pointer());
+  for (int i = 0; i < kNumberOfSegmentSizeClasses; i++) {
+    while (free_segments[i] != NULL) {
+      FreeSegment* segment = free_segments[i];
+      free_segments[i] = segment->next;
+      base::NoBarrier_AtomicIncrement(&segment_bytes_held, -SegmentSize(i));
+      Malloced::Delete(segment);
+    }
+  }
+  for (SegmentThreadCache* cache = segment_thread_caches; cache != NULL;
+       cache = cache->next) {
+    base::LockGuard<base::Mutex> cache_guard(&cache->mutex);
+    ClearSegmentThreadCache(cache);
+  }
+}
+
+
+intptr_t ZoneSegmentPool::bytes_held() {
+  return base::NoBarrier_Load(&segment_bytes_held);
+}
+
+
+intptr_t ZoneSegmentPool::bytes_in_use() {
+  return base::NoBarrier_Load(&segment_bytes_in_use);
+}
+
+
+// ----------------------------------------------------------------------------
+// Zone
+
+
 // Segments represent chunks of memory: They have starting address
 // (encoded in the this pointer) and a size in bytes. Segments are
 // chained together forming a LIFO structure with the newest segment
@@ -181,7 +395,10 @@ void Zone::DeleteKeptSegment() {
 // Creates a new segment, sets it size, and pushes it to the front
 // of the segment chain. Returns the new segment.
 Segment* Zone::NewSegment(int size) {
-  Segment* result = reinterpret_cast<Segment*>(Malloced::New(size));
+  bool reused;
+  Segment* result =
+      reinterpret_cast<Segment*>(ZoneSegmentPool::Allocate(size, &reused));
+  if (reused) isolate_->counters()->zone_segments_reused()->Increment();
   adjust_segment_bytes_allocated(size);
   if (result != NULL) {
     result->Initialize(segment_head_, size);
@@ -194,7 +411,7 @@ Segment* Zone::NewSegment(int size) {
 // Deletes the given segment. Does not touch the segment chain.
 void Zone::DeleteSegment(Segment* segment, int size) {
   adjust_segment_bytes_allocated(-size);
-  Malloced::Delete(segment);
+  ZoneSegmentPool::Free(segment, size);
 }
 
 
@@ -233,7 +450,12 @@ Address Zone::NewExpand(int size) {
     V8::FatalProcessOutOfMemory("Zone");
     return NULL;
   }
-  Segment* segment = NewSegment(static_cast<int>(new_size));
+  // Round up to a size class so that the segment can be recycled. Only
+  // segments small enough to be kept by DeleteAll are rounded.
+  STATIC_ASSERT(ZoneSegmentPool::kMaximumPooledSegmentSize ==
+                kMaximumKeptSegmentSize);
+  Segment* segment = NewSegment(
+      ZoneSegmentPool::RoundUpToSizeClass(static_cast<int>(new_size)));
   if (segment == NULL) {
     V8::FatalProcessOutOfMemory("Zone");
     return NULL;
@@ -21,6 +21,50 @@ namespace internal {
 class Segment;
 class Isolate;
 
+
+// Process-wide pool of zone segments. Segments of up to
+// kMaximumPooledSegmentSize bytes are rounded up to a power of two and
+// recycled instead of being returned to malloc() when a zone frees them.
+// Larger segments are allocated at their exact size and never pooled, as
+// rounding them up could waste almost half of their memory.
+// Each thread keeps at most one unused segment of every size class in a
+// thread-local cache so that zones on different threads (the main thread
+// and the optimizing compiler thread) rarely contend on the shared free
+// lists. The number of bytes held in unused segments is limited by
+// --zone-segment-pool-size.
+class ZoneSegmentPool : public AllStatic {
+ public:
+  static const int kMinimumPooledSegmentSize = 8 * KB;
+  // Same as Zone::kMaximumKeptSegmentSize.
+  static const int kMaximumPooledSegmentSize = 64 * KB;
+
+  static void SetUp();
+  static void TearDown();
+
+  // Returns the size a new segment of at least |size| bytes is allocated
+  // with, i.e. its size class, or |size| itself if it is not pooled.
+  static int RoundUpToSizeClass(int size);
+
+  // Returns a segment of |size| bytes, reusing an unused one if possible.
+  // |size| must have been rounded by RoundUpToSizeClass.
+  static void* Allocate(int size, bool* reused);
+
+  // Takes back a segment of |size| bytes, keeping it for reuse if the
+  // retention budget allows.
+  static void Free(void* segment, int size);
+
+  // Returns all unused segments of the calling thread, or of all threads,
+  // to malloc().
+  static void ReleaseThreadCache();
+  static void ReleaseUnusedSegments();
+
+  // Bytes in unused segments that are kept for reuse, and bytes in
+  // segments that are currently owned by zones.
+  static intptr_t bytes_held();
+  static intptr_t bytes_in_use();
+};
+
+
 // The Zone supports very fast allocation of small chunks of
 // memory. The chunks cannot be deallocated individually, but instead
 // the Zone supports deallocating all chunks in one fast
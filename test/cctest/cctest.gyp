@@ -139,6 +139,7 @@
         'test-platform.cc',
         'test-profile-generator.cc',
         'test-random-number-generator.cc',
+        'test-recompilation-queue.cc',
         'test-regexp.cc',
         'test-reloc-info.cc',
         'test-representation.cc',
@@ -158,6 +159,7 @@
         'test-weakmaps.cc',
         'test-weaksets.cc',
         'test-weaktypedarrays.cc',
+        'test-zone.cc',
         'trace-extension.cc'
       ],
       'conditions': [
@@ -61,8 +61,6 @@ class DeoptCodegenTester {
     graph = new (scope_->main_zone()) Graph(scope_->main_zone());
   }
 
-  virtual ~DeoptCodegenTester() { delete code; }
-
   void GenerateCodeFromSchedule(Schedule* schedule) {
     OFStream os(stdout);
     if (FLAG_trace_turbo) {
@@ -71,8 +69,8 @@ class DeoptCodegenTester {
 
     // Initialize the codegen and generate code.
     Linkage* linkage = new (scope_->main_zone()) Linkage(&info);
-    code = new v8::internal::compiler::InstructionSequence(linkage, graph,
-                                                           schedule);
+    code = new (scope_->main_zone())
+        v8::internal::compiler::InstructionSequence(linkage, graph, schedule);
     SourcePositionTable source_positions(graph);
     InstructionSelector selector(code, &source_positions);
     selector.SelectInstructions();
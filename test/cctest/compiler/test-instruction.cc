@@ -9,12 +9,13 @@
 #include "src/compiler/common-operator.h"
 #include "src/compiler/graph.h"
 #include "src/compiler/instruction.h"
+#include "src/compiler/jump-threading.h"
 #include "src/compiler/machine-operator.h"
 #include "src/compiler/node.h"
 #include "src/compiler/operator.h"
+#include "src/compiler/register-allocator.h"
 #include "src/compiler/schedule.h"
 #include "src/compiler/scheduler.h"
-#include "src/lithium.h"
 
 using namespace v8::internal;
 using namespace v8::internal::compiler;
@@ -35,8 +36,6 @@ class InstructionTester : public HandleAndZoneScope {
         machine(zone()),
         code(NULL) {}
 
-  ~InstructionTester() { delete code; }
-
   Isolate* isolate;
   Graph graph;
   Schedule schedule;
@@ -54,7 +53,7 @@ class InstructionTester : public HandleAndZoneScope {
       Scheduler::ComputeSpecialRPO(&schedule);
       DCHECK(schedule.rpo_order()->size() > 0);
     }
-    code = new TestInstrSeq(&linkage, &graph, &schedule);
+    code = new (zone()) TestInstrSeq(&linkage, &graph, &schedule);
   }
 
   Node* Int32Constant(int32_t val) {
@@ -87,6 +86,53 @@ class InstructionTester : public HandleAndZoneScope {
     return code->AddInstruction(instr, block);
   }
 
+  int NewJump(BasicBlock* block, BasicBlock* target) {
+    InstructionOperand* label = ImmediateOperand::Create(
+        code->AddImmediate(Constant(target->id())), zone());
+    TestInstr* instr =
+        TestInstr::New(zone(), kArchJmp, 0, NULL, 1, &label, 0, NULL);
+    return code->AddInstruction(instr->MarkAsControl(), block);
+  }
+
+  int NewFallThrough(BasicBlock* block) {
+    TestInstr* instr = TestInstr::New(zone(), kArchNop);
+    return code->AddInstruction(instr->MarkAsControl(), block);
+  }
+
+  int NewDefinition(BasicBlock* block, int vreg) {
+    InstructionOperand* output =
+        NewUnallocated(vreg, UnallocatedOperand::MUST_HAVE_REGISTER);
+    TestInstr* instr =
+        TestInstr::New(zone(), kArchNop, 1, &output, 0, NULL, 0, NULL);
+    return code->AddInstruction(instr, block);
+  }
+
+  int NewUse(BasicBlock* block, int vreg) {
+    InstructionOperand* input =
+        NewUnallocated(vreg, UnallocatedOperand::MUST_HAVE_REGISTER);
+    TestInstr* instr =
+        TestInstr::New(zone(), kArchNop, 0, NULL, 1, &input, 0, NULL);
+    return code->AddInstruction(instr, block);
+  }
+
+  int NewCall(BasicBlock* block) {
+    TestInstr* instr = TestInstr::New(zone(), kArchNop);
+    return code->AddInstruction(instr->MarkAsCall(), block);
+  }
+
+  int NewReturn(BasicBlock* block) {
+    TestInstr* instr = TestInstr::New(zone(), kArchRet);
+    return code->AddInstruction(instr->MarkAsControl(), block);
+  }
+
+  UnallocatedOperand* NewUnallocated(
+      int vreg, UnallocatedOperand::ExtendedPolicy policy) {
+    UnallocatedOperand* unallocated =
+        new (zone()) UnallocatedOperand(policy);
+    unallocated->set_virtual_register(vreg);
+    return unallocated;
+  }
+
   UnallocatedOperand* NewUnallocated(int vreg) {
     UnallocatedOperand* unallocated =
         new (zone()) UnallocatedOperand(UnallocatedOperand::ANY);
@@ -348,3 +394,241 @@ TEST(InstructionOperands) {
     }
   }
 }
+
+
+TEST(JumpThreadingSkipsEmptyBlocks) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.NewBasicBlock();
+  BasicBlock* b2 = R.schedule.NewBasicBlock();
+  BasicBlock* b3 = R.schedule.end();
+
+  R.schedule.AddGoto(b0, b1);
+  R.schedule.AddGoto(b1, b2);
+  R.schedule.AddGoto(b2, b3);
+
+  R.allocCode();
+
+  R.code->StartBlock(b0);
+  R.NewInstr(b0);
+  R.NewJump(b0, b1);
+  R.code->EndBlock(b0);
+  R.code->StartBlock(b1);
+  R.NewJump(b1, b2);
+  R.code->EndBlock(b1);
+  R.code->StartBlock(b2);
+  R.NewFallThrough(b2);
+  R.code->EndBlock(b2);
+  R.code->StartBlock(b3);
+  R.NewInstr(b3);
+  R.code->EndBlock(b3);
+
+  CHECK(JumpThreading::ApplyForwarding(R.code));
+
+  CHECK_EQ(b0, R.code->GetForwardedBlock(b0));
+  CHECK_EQ(b3, R.code->GetForwardedBlock(b1));
+  CHECK_EQ(b3, R.code->GetForwardedBlock(b2));
+  CHECK_EQ(b3, R.code->GetForwardedBlock(b3));
+  CHECK_EQ(R.code->GetLabel(b3), R.code->GetLabel(b1));
+
+  CHECK(!R.code->IsSkipped(b0));
+  CHECK(R.code->IsSkipped(b1));
+  CHECK(R.code->IsSkipped(b2));
+  CHECK(!R.code->IsSkipped(b3));
+}
+
+
+TEST(JumpThreadingKeepsFallThroughTarget) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.NewBasicBlock();
+  BasicBlock* b2 = R.schedule.end();
+
+  R.schedule.AddGoto(b0, b1);
+  R.schedule.AddGoto(b1, b2);
+
+  R.allocCode();
+
+  R.code->StartBlock(b0);
+  R.NewInstr(b0);
+  R.NewFallThrough(b0);
+  R.code->EndBlock(b0);
+  R.code->StartBlock(b1);
+  R.NewJump(b1, b2);
+  R.code->EndBlock(b1);
+  R.code->StartBlock(b2);
+  R.NewInstr(b2);
+  R.code->EndBlock(b2);
+
+  CHECK(JumpThreading::ApplyForwarding(R.code));
+
+  // Jumps to {b1} go to {b2}, but {b0} still falls through into {b1}.
+  CHECK_EQ(b2, R.code->GetForwardedBlock(b1));
+  CHECK(!R.code->IsSkipped(b1));
+}
+
+
+TEST(JumpThreadingKeepsBlocksWithMoves) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.NewBasicBlock();
+  BasicBlock* b2 = R.schedule.end();
+
+  R.schedule.AddGoto(b0, b1);
+  R.schedule.AddGoto(b1, b2);
+
+  R.allocCode();
+
+  R.code->StartBlock(b0);
+  R.NewInstr(b0);
+  R.NewJump(b0, b1);
+  R.code->EndBlock(b0);
+  R.code->StartBlock(b1);
+  int jump = R.NewJump(b1, b2);
+  R.code->EndBlock(b1);
+  R.code->StartBlock(b2);
+  R.NewInstr(b2);
+  R.code->EndBlock(b2);
+
+  R.code->AddGapMove(jump - 1, RegisterOperand::Create(0, R.zone()),
+                     RegisterOperand::Create(1, R.zone()));
+
+  CHECK(!JumpThreading::ApplyForwarding(R.code));
+  CHECK_EQ(b1, R.code->GetForwardedBlock(b1));
+  CHECK(!R.code->IsSkipped(b1));
+}
+
+
+TEST(JumpThreadingMakesJumpTargetNextInAssemblyOrder) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.NewBasicBlock();
+  BasicBlock* b2 = R.schedule.NewBasicBlock();
+  BasicBlock* b3 = R.schedule.end();
+
+  R.schedule.AddGoto(b0, b2);
+  R.schedule.AddGoto(b1, b3);
+  R.schedule.AddGoto(b2, b3);
+
+  // Lay the blocks out in this order, so that {b1} lies between {b0} and the
+  // target of its goto.
+  BasicBlock* order[] = {b0, b1, b2, b3};
+  for (int i = 0; i < 4; i++) {
+    order[i]->rpo_number_ = i;
+    R.schedule.rpo_order()->push_back(order[i]);
+  }
+  R.allocCode();
+
+  R.code->StartBlock(b0);
+  R.NewInstr(b0);
+  R.NewJump(b0, b2);
+  R.code->EndBlock(b0);
+  R.code->StartBlock(b1);
+  R.NewJump(b1, b3);
+  R.code->EndBlock(b1);
+  R.code->StartBlock(b2);
+  R.NewInstr(b2);
+  R.NewJump(b2, b3);
+  R.code->EndBlock(b2);
+  R.code->StartBlock(b3);
+  R.NewInstr(b3);
+  R.code->EndBlock(b3);
+
+  // The goto in {b0} was selected as a jump since {b1} lies in between.
+  CHECK(!R.code->IsNextInAssemblyOrder(b0, b2));
+
+  CHECK(JumpThreading::ApplyForwarding(R.code));
+
+  // Nothing falls into the empty {b1}, so it is skipped and the jump from
+  // {b0} to {b2} needs no code.
+  CHECK(R.code->IsSkipped(b1));
+  CHECK(R.code->IsNextInAssemblyOrder(b0, b2));
+  CHECK(R.code->IsNextInAssemblyOrder(b2, b3));
+  CHECK(!R.code->IsNextInAssemblyOrder(b0, b3));
+}
+
+
+static int SpillSlotIndex(RegisterAllocator* allocator, int vreg) {
+  LiveRange* range = allocator->live_ranges()->at(vreg);
+  CHECK(range->HasAllocatedSpillOperand());
+  InstructionOperand* slot = range->GetSpillOperand();
+  CHECK(slot->IsStackSlot());
+  return slot->index();
+}
+
+
+TEST(RegisterAllocatorSharesSpillSlotsOfDisjointRanges) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.end();
+  R.schedule.AddGoto(b0, b1);
+  R.allocCode();
+
+  int v0 = R.code->NextVirtualRegister();
+  int v1 = R.code->NextVirtualRegister();
+
+  // Both values live across a call, which clobbers all registers, so both
+  // are spilled. {v1} is only defined after the last use of {v0}.
+  R.code->StartBlock(b0);
+  R.NewDefinition(b0, v0);
+  R.NewCall(b0);
+  R.NewUse(b0, v0);
+  R.NewDefinition(b0, v1);
+  R.NewCall(b0);
+  R.NewUse(b0, v1);
+  R.NewReturn(b0);
+  R.code->EndBlock(b0);
+  R.code->StartBlock(b1);
+  R.code->EndBlock(b1);
+
+  RegisterAllocator allocator(R.code);
+  CHECK(allocator.Allocate());
+
+  CHECK_EQ(SpillSlotIndex(&allocator, v0), SpillSlotIndex(&allocator, v1));
+  CHECK_EQ(1, R.code->frame()->GetSpillSlotCount());
+}
+
+
+TEST(RegisterAllocatorKeepsSpillSlotsOfOverlappingRanges) {
+  InstructionTester R;
+
+  BasicBlock* b0 = R.schedule.start();
+  BasicBlock* b1 = R.schedule.end();
+  R.schedule.AddGoto(b0, b1);
+  R.allocCode();
+
+  int v0 = R.code->NextVirtualRegister();
+  int v1 = R.code->NextVirtualRegister();
+  int v2 = R.code->NextVirtualRegister();
+
+  // {v0} is spilled around the first call and ends before {v2} is defined,
+  // but {v1} is live across both calls and must keep a slot of its own.
+  R.code->StartBlock(b0);
+  R.NewDefinition(b0, v0);
+  R.NewDefinition(b0, v1);
+  R.NewCall(b0);
+  R.NewUse(b0, v0);
+  R.NewDefinition(b0, v2);
+  R.NewCall(b0);
+  R.NewUse(b0, v2);
+  R.NewUse(b0, v1);
+  R.NewReturn(b0);
+  R.code->EndBlock(b0);
+  R.code->StartBlock(b1);
+  R.code->EndBlock(b1);
+
+  RegisterAllocator allocator(R.code);
+  CHECK(allocator.Allocate());
+
+  int s0 = SpillSlotIndex(&allocator, v0);
+  int s1 = SpillSlotIndex(&allocator, v1);
+  int s2 = SpillSlotIndex(&allocator, v2);
+  CHECK_NE(s0, s1);
+  CHECK_NE(s1, s2);
+  CHECK_EQ(s0, s2);
+}
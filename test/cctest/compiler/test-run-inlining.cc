@@ -243,4 +243,22 @@ TEST(InlineNonStrictIntoStrict) {
 }
 
 
+TEST(DontInlineOverCumulativeBudget) {
+  int saved_budget = FLAG_max_inlined_nodes_cumulative;
+  FLAG_max_inlined_nodes_cumulative = 0;
+  FunctionTester T(
+      "(function () {"
+      "function foo(s) { AssertStackDepth(2); return s; };"
+      "function bar(s, t) { return foo(s); };"
+      "return bar;"
+      "})();",
+      CompilationInfo::kInliningEnabled |
+          CompilationInfo::kContextSpecializing);
+  FLAG_max_inlined_nodes_cumulative = saved_budget;
+
+  InstallAssertStackDepthHelper(CcTest::isolate());
+  T.CheckCall(T.Val(1), T.Val(1), T.Val(2));
+}
+
+
 #endif  // V8_TURBOFAN_TARGET
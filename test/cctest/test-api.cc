@@ -9709,6 +9709,44 @@ THREADED_TEST(CrossDomainAccessors) {
   context0->Exit();
 }
 
+static i::Object* FindOwnLoadHandler(v8::Handle<v8::Object> object,
+                                     const char* name) {
+  i::Handle<i::JSObject> obj = v8::Utils::OpenHandle(*object);
+  i::Handle<i::String> key =
+      CcTest::i_isolate()->factory()->InternalizeUtf8String(name);
+  i::Code::Flags flags = i::Code::ComputeHandlerFlags(
+      i::Code::LOAD_IC, i::Code::FAST, i::kCacheOnReceiver);
+  return obj->map()->FindInCodeCache(*key, flags);
+}
+
+
+TEST(ApiLoadHandlerSharedAcrossContexts) {
+  i::FLAG_share_api_load_handlers = true;
+  v8::Isolate* isolate = CcTest::isolate();
+  v8::HandleScope handle_scope(isolate);
+  v8::Handle<v8::ObjectTemplate> templ = v8::ObjectTemplate::New(isolate);
+  templ->SetAccessor(v8_str("ten"), ConstTenGetter);
+
+  v8::Handle<v8::Object> objects[2];
+  for (int i = 0; i < 2; i++) {
+    LocalContext context;
+    objects[i] = templ->NewInstance();
+    context->Global()->Set(v8_str("obj"), objects[i]);
+    v8::Handle<Value> result = CompileRun(
+        "function f(o) { return o.ten; }"
+        "for (var i = 0; i < 5; i++) f(obj);"
+        "f(obj)");
+    CHECK_EQ(10, result->Int32Value());
+  }
+
+  // Every context has its own maps but compiles no handler of its own.
+  CHECK(v8::Utils::OpenHandle(*objects[0])->map() !=
+        v8::Utils::OpenHandle(*objects[1])->map());
+  i::Object* handler = FindOwnLoadHandler(objects[0], "ten");
+  CHECK(handler->IsCode());
+  CHECK(handler == FindOwnLoadHandler(objects[1], "ten"));
+}
+
 
 static int named_access_count = 0;
 static int indexed_access_count = 0;
@@ -17957,6 +17995,30 @@ THREADED_TEST(GetHeapStatistics) {
 }
 
 
+TEST(GetCompilePhaseStatistics) {
+  i::FLAG_compile_stats = true;
+  LocalContext env;
+  v8::Isolate* isolate = env->GetIsolate();
+  v8::HandleScope scope(isolate);
+  CompileRun("function f(x) { return x + 1; } f(1);");
+
+  bool found_parser = false;
+  bool found_full_codegen = false;
+  v8::CompilePhaseStatistics stats;
+  int count = isolate->NumberOfCompilePhases();
+  for (int i = 0; i < count; i++) {
+    CHECK(isolate->GetCompilePhaseStatistics(i, &stats));
+    CHECK_LT(0, stats.count());
+    if (strcmp(stats.tier(), "parser") == 0) found_parser = true;
+    if (strcmp(stats.tier(), "full-codegen") == 0) found_full_codegen = true;
+  }
+  CHECK(found_parser);
+  CHECK(found_full_codegen);
+  CHECK(!isolate->GetCompilePhaseStatistics(count, &stats));
+  i::FLAG_compile_stats = false;
+}
+
+
 class VisitorImpl : public v8::ExternalResourceVisitor {
  public:
   explicit VisitorImpl(TestResource** resource) {
@@ -21066,6 +21128,37 @@ TEST(PrimaryStubCache) {
 }
 
 
+TEST(StubCacheTableBits) {
+  // The probes load the table masks, so the megamorphic stubs from the
+  // snapshot also work with tables sized for another isolate.
+  i::FLAG_stub_cache_primary_bits = 4;
+  i::FLAG_stub_cache_secondary_bits = 4;
+  v8::Isolate* isolate = v8::Isolate::New();
+  {
+    v8::Isolate::Scope isolate_scope(isolate);
+    v8::HandleScope scope(isolate);
+    LocalContext env(isolate);
+    ExpectInt32(
+        "function get(o) { return o.x; }"
+        "var objects = [];"
+        "for (var i = 0; i < 64; i++) {"
+        "  var o = { x: i };"
+        "  o['p' + i] = i;"
+        "  objects.push(o);"
+        "}"
+        "var sum = 0;"
+        "for (var k = 0; k < 10; k++) {"
+        "  for (var i = 0; i < 64; i++) sum += get(objects[i]);"
+        "}"
+        "sum",
+        10 * 63 * 64 / 2);
+  }
+  isolate->Dispose();
+  i::FLAG_stub_cache_primary_bits = 11;
+  i::FLAG_stub_cache_secondary_bits = 9;
+}
+
+
 #ifdef DEBUG
 static int cow_arrays_created_runtime = 0;
 
@@ -59,3 +59,32 @@ TEST(List) {
   CHECK_EQ(0, list->length());
   delete list;
 }
+
+
+TEST(ExpressionIdsAndBounds) {
+  v8::internal::V8::Initialize(NULL);
+  Isolate* isolate = CcTest::i_isolate();
+  Zone zone(isolate);
+  AstNode::IdGen id_gen;
+  AstNodeFactory<AstNullVisitor> factory(&zone, NULL, &id_gen);
+  Expression* first = factory.NewThisFunction(RelocInfo::kNoPosition);
+  Expression* second = factory.NewThisFunction(RelocInfo::kNoPosition);
+
+  // Every expression reserves its own id and the test id following it.
+  CHECK_EQ(first->id().ToInt() + 1, first->test_id().ToInt());
+  CHECK_EQ(first->test_id().ToInt() + 1, second->id().ToInt());
+
+  // Bounds start out unrestricted and are allocated when narrowed.
+  CHECK(first->bounds().lower->Is(Type::None()));
+  CHECK(Type::Any()->Is(first->bounds().upper));
+  unsigned allocation_size = zone.allocation_size();
+  first->set_bounds(Bounds(Type::Number(), Type::Number()), &zone);
+  CHECK_LT(allocation_size, zone.allocation_size());
+  CHECK(first->bounds().lower->Is(Type::Number()));
+  CHECK(first->bounds().upper->Is(Type::Number()));
+  CHECK(second->bounds().lower->Is(Type::None()));
+
+  // The parenthesization level saturates instead of wrapping around.
+  for (int i = 0; i < 1000; i++) first->increase_parenthesization_level();
+  CHECK_LT(1, first->parenthesization_level());
+}
@@ -599,6 +599,8 @@ TEST(HeapSnapshotCollection) {
   const v8::HeapGraphNode* set_table =
       GetProperty(set, v8::HeapGraphEdge::kInternal, "table");
   CHECK_EQ(v8::HeapGraphNode::kArray, set_table->GetType());
+  CHECK_EQ(v8_str("(ordered hash table 2 of 4, 0 deleted)"),
+           set_table->GetName());
   CHECK_GT(set_table->GetChildrenCount(), 0);
   int entries = 0;
   for (int i = 0, count = set_table->GetChildrenCount(); i < count; ++i) {
@@ -623,6 +625,8 @@ TEST(HeapSnapshotCollection) {
   const v8::HeapGraphNode* map_table =
       GetProperty(map, v8::HeapGraphEdge::kInternal, "table");
   CHECK_EQ(v8::HeapGraphNode::kArray, map_table->GetType());
+  CHECK_EQ(v8_str("(ordered hash table 1 of 4, 0 deleted)"),
+           map_table->GetName());
   CHECK_GT(map_table->GetChildrenCount(), 0);
   entries = 0;
   for (int i = 0, count = map_table->GetChildrenCount(); i < count; ++i) {
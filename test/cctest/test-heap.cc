@@ -3275,6 +3275,49 @@ TEST(IncrementalMarkingClearsPolymorphicIC) {
 }
 
 
+static const char* kShapeFamilySource =
+    "function make(n) {"
+    "  var o = { x: n };"
+    "  if (n > 0) o.a = 0;"
+    "  if (n > 1) o.b = 1;"
+    "  if (n > 2) o.c = 2;"
+    "  if (n > 3) o.d = 3;"
+    "  if (n > 4) o.e = 4;"
+    "  if (n > 5) o.f = 5;"
+    "  return o;"
+    "}"
+    "var objects = [];"
+    "for (var i = 0; i < 7; i++) objects.push(make(i));"
+    "function f(o) { return o.x; }"
+    "for (var i = 0; i < objects.length; i++) f(objects[i]);";
+
+
+static InlineCacheState ShapeFamilyLoadICState(bool shape_family_ics) {
+  FLAG_shape_family_ics = shape_family_ics;
+  FLAG_max_polymorphism = 4;
+  CcTest::InitializeVM();
+  LocalContext env;
+  v8::HandleScope scope(CcTest::isolate());
+
+  // The receivers are on one branch of the transition tree and have more
+  // maps than a polymorphic load IC may hold.
+  CompileRun(kShapeFamilySource);
+  Handle<JSFunction> f =
+      v8::Utils::OpenHandle(
+          *v8::Handle<v8::Function>::Cast(env->Global()->Get(v8_str("f"))));
+  CHECK_EQ(6, CompileRun("f(objects[6])")->Int32Value());
+  return FindFirstIC(f->shared()->code(), Code::LOAD_IC)->ic_state();
+}
+
+
+TEST(ShapeFamilyLoadIC) {
+  if (i::FLAG_always_opt) return;
+  CHECK_EQ(POLYMORPHIC, ShapeFamilyLoadICState(true));
+  CHECK_EQ(MEGAMORPHIC, ShapeFamilyLoadICState(false));
+  FLAG_shape_family_ics = true;
+}
+
+
 class SourceResource: public v8::String::ExternalAsciiStringResource {
  public:
   explicit SourceResource(const char* data)
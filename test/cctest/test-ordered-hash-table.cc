@@ -176,4 +176,42 @@ TEST(Map) {
 }
 
 
+TEST(Compaction) {
+  LocalContext context;
+  Isolate* isolate = CcTest::i_isolate();
+  Factory* factory = isolate->factory();
+  HandleScope scope(isolate);
+  Handle<OrderedHashSet> ordered_set = factory->NewOrderedHashSet();
+  Handle<Map> map = factory->NewMap(JS_OBJECT_TYPE, JSObject::kHeaderSize);
+  const int kCount = 8;
+  Handle<JSObject> objs[kCount];
+  for (int i = 0; i < kCount; i++) {
+    objs[i] = factory->NewJSObjectFromMap(map);
+    ordered_set = OrderedHashSet::Add(ordered_set, objs[i]);
+  }
+  CHECK_EQ(kCount, ordered_set->NumberOfElements());
+  CHECK_EQ(4, ordered_set->NumberOfBuckets());
+
+  // The holes are kept while there are fewer of them than live entries.
+  bool was_present = false;
+  for (int i = 0; i < 4; i++) {
+    ordered_set = OrderedHashSet::Remove(ordered_set, objs[i], &was_present);
+    CHECK(was_present);
+  }
+  CHECK_EQ(4, ordered_set->NumberOfElements());
+  CHECK_EQ(4, ordered_set->NumberOfDeletedElements());
+
+  // Once the holes outnumber the live entries the table is compacted
+  // without changing its size.
+  ordered_set = OrderedHashSet::Remove(ordered_set, objs[4], &was_present);
+  CHECK(was_present);
+  CHECK_EQ(3, ordered_set->NumberOfElements());
+  CHECK_EQ(0, ordered_set->NumberOfDeletedElements());
+  CHECK_EQ(4, ordered_set->NumberOfBuckets());
+  for (int i = 0; i < kCount; i++) {
+    CHECK_EQ(i > 4, ordered_set->Contains(objs[i]));
+  }
+}
+
+
 }
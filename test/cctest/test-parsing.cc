@@ -543,10 +543,19 @@ void TestCharacterStream(const char* ascii_source,
   TestExternalResource resource(uc16_buffer.get(), length);
   i::Handle<i::String> uc16_string(
       factory->NewExternalStringFromTwoByte(&resource).ToHandleChecked());
+  // The resource is deleted when the external string is collected.
+  ScriptResource* ascii_resource = new ScriptResource(ascii_source, length);
+  i::Handle<i::String> ascii_external_string(
+      factory->NewExternalStringFromAscii(ascii_resource).ToHandleChecked());
 
   i::ExternalTwoByteStringUtf16CharacterStream uc16_stream(
       i::Handle<i::ExternalTwoByteString>::cast(uc16_string), start, end);
   i::GenericStringUtf16CharacterStream string_stream(ascii_string, start, end);
+  i::OneByteStringUtf16CharacterStream one_byte_stream(ascii_string, start,
+                                                      end);
+  i::ExternalOneByteStringUtf16CharacterStream external_one_byte_stream(
+      i::Handle<i::ExternalAsciiString>::cast(ascii_external_string), start,
+      end);
   i::Utf8ToUtf16CharacterStream utf8_stream(
       reinterpret_cast<const i::byte*>(ascii_source), end);
   utf8_stream.SeekForward(start);
@@ -556,17 +565,25 @@ void TestCharacterStream(const char* ascii_source,
     // Read streams one char at a time
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     int32_t c0 = ascii_source[i];
     int32_t c1 = uc16_stream.Advance();
     int32_t c2 = string_stream.Advance();
+    int32_t c4 = one_byte_stream.Advance();
+    int32_t c5 = external_one_byte_stream.Advance();
     int32_t c3 = utf8_stream.Advance();
     i++;
     CHECK_EQ(c0, c1);
     CHECK_EQ(c0, c2);
+    CHECK_EQ(c0, c4);
+    CHECK_EQ(c0, c5);
     CHECK_EQ(c0, c3);
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
   }
   while (i > start + sub_length / 4) {
@@ -574,64 +591,96 @@ void TestCharacterStream(const char* ascii_source,
     int32_t c0 = ascii_source[i - 1];
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     uc16_stream.PushBack(c0);
     string_stream.PushBack(c0);
+    one_byte_stream.PushBack(c0);
+    external_one_byte_stream.PushBack(c0);
     utf8_stream.PushBack(c0);
     i--;
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     int32_t c1 = uc16_stream.Advance();
     int32_t c2 = string_stream.Advance();
+    int32_t c4 = one_byte_stream.Advance();
+    int32_t c5 = external_one_byte_stream.Advance();
     int32_t c3 = utf8_stream.Advance();
     i++;
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     CHECK_EQ(c0, c1);
     CHECK_EQ(c0, c2);
+    CHECK_EQ(c0, c4);
+    CHECK_EQ(c0, c5);
     CHECK_EQ(c0, c3);
     uc16_stream.PushBack(c0);
     string_stream.PushBack(c0);
+    one_byte_stream.PushBack(c0);
+    external_one_byte_stream.PushBack(c0);
     utf8_stream.PushBack(c0);
     i--;
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
   }
   unsigned halfway = start + sub_length / 2;
   uc16_stream.SeekForward(halfway - i);
   string_stream.SeekForward(halfway - i);
+  one_byte_stream.SeekForward(halfway - i);
+  external_one_byte_stream.SeekForward(halfway - i);
   utf8_stream.SeekForward(halfway - i);
   i = halfway;
   CHECK_EQU(i, uc16_stream.pos());
   CHECK_EQU(i, string_stream.pos());
+  CHECK_EQU(i, one_byte_stream.pos());
+  CHECK_EQU(i, external_one_byte_stream.pos());
   CHECK_EQU(i, utf8_stream.pos());
 
   while (i < end) {
     // Read streams one char at a time
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
     int32_t c0 = ascii_source[i];
     int32_t c1 = uc16_stream.Advance();
     int32_t c2 = string_stream.Advance();
+    int32_t c4 = one_byte_stream.Advance();
+    int32_t c5 = external_one_byte_stream.Advance();
     int32_t c3 = utf8_stream.Advance();
     i++;
     CHECK_EQ(c0, c1);
     CHECK_EQ(c0, c2);
+    CHECK_EQ(c0, c4);
+    CHECK_EQ(c0, c5);
     CHECK_EQ(c0, c3);
     CHECK_EQU(i, uc16_stream.pos());
     CHECK_EQU(i, string_stream.pos());
+    CHECK_EQU(i, one_byte_stream.pos());
+    CHECK_EQU(i, external_one_byte_stream.pos());
     CHECK_EQU(i, utf8_stream.pos());
   }
 
   int32_t c1 = uc16_stream.Advance();
   int32_t c2 = string_stream.Advance();
+  int32_t c4 = one_byte_stream.Advance();
+  int32_t c5 = external_one_byte_stream.Advance();
   int32_t c3 = utf8_stream.Advance();
   CHECK_LT(c1, 0);
   CHECK_LT(c2, 0);
+  CHECK_LT(c4, 0);
+  CHECK_LT(c5, 0);
   CHECK_LT(c3, 0);
 }
 
@@ -790,6 +839,67 @@ TEST(StreamScanner) {
 }
 
 
+static int AppendRun(char* buffer, int position, char c, int length) {
+  for (int i = 0; i < length; i++) buffer[position++] = c;
+  return position;
+}
+
+
+static int AppendString(char* buffer, int position, const char* string) {
+  int length = i::StrLength(string);
+  i::MemCopy(buffer + position, string, length);
+  return position + length;
+}
+
+
+TEST(ScanLongRuns) {
+  // Whitespace, comments, identifiers and strings are consumed in bulk by
+  // the scanner. Check runs of all lengths, including ones that span the
+  // blocks of a buffered character stream.
+  v8::V8::Initialize();
+  i::UnicodeCache unicode_cache;
+  for (int length = 1; length < 1200; length += 29) {
+    i::ScopedVector<char> source(6 * length + 64);
+    i::ScopedVector<char> identifier(length + 4);
+    i::ScopedVector<char> string(length + 1);
+    int end = AppendRun(identifier.start(), 0, 'a', length);
+    end = AppendString(identifier.start(), end, "$_9");
+    identifier[end] = '\0';
+    AppendRun(string.start(), 0, 's', length);
+    string[length] = '\0';
+
+    int pos = AppendRun(source.start(), 0, ' ', length);
+    pos = AppendString(source.start(), pos, "//");
+    pos = AppendRun(source.start(), pos, '*', length);
+    pos = AppendString(source.start(), pos, "\n\t/*");
+    pos = AppendRun(source.start(), pos, 'c', length);
+    pos = AppendString(source.start(), pos, "*/");
+    int identifier_pos = pos;
+    pos = AppendString(source.start(), pos, identifier.start());
+    pos = AppendString(source.start(), pos, " '");
+    pos = AppendString(source.start(), pos, string.start());
+    pos = AppendString(source.start(), pos, "' /*");
+    pos = AppendRun(source.start(), pos, 'c', length);
+    pos = AppendString(source.start(), pos, "\n*/x");
+
+    i::Utf8ToUtf16CharacterStream stream(
+        reinterpret_cast<const i::byte*>(source.start()), pos);
+    i::Scanner scanner(&unicode_cache);
+    scanner.Initialize(&stream);
+    CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+    CHECK_EQ(identifier_pos, scanner.location().beg_pos);
+    CHECK(scanner.UnescapedLiteralMatches(identifier.start(), length + 3));
+    CHECK(!scanner.HasAnyLineTerminatorBeforeNext());
+    CHECK_EQ(i::Token::STRING, scanner.Next());
+    CHECK(scanner.UnescapedLiteralMatches(string.start(), length));
+    CHECK(scanner.HasAnyLineTerminatorBeforeNext());
+    CHECK_EQ(i::Token::IDENTIFIER, scanner.Next());
+    CHECK_EQ(pos - 1, scanner.location().beg_pos);
+    CHECK_EQ(i::Token::EOS, scanner.Next());
+  }
+}
+
+
 void TestScanRegExp(const char* re_source, const char* expected) {
   i::Utf8ToUtf16CharacterStream stream(
        reinterpret_cast<const i::byte*>(re_source),
@@ -0,0 +1,71 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/optimizing-compiler-thread.h"
+#include "test/cctest/cctest.h"
+
+using namespace v8::internal;
+
+
+// The queue never looks at its jobs, so distinct fake pointers will do.
+static OptimizedCompileJob* Job(int id) {
+  return reinterpret_cast<OptimizedCompileJob*>(
+      static_cast<intptr_t>(id) * kPointerSize);
+}
+
+
+static OptimizedCompileJob* Dequeue(RecompilationQueue* queue) {
+  v8::base::TimeTicks queued_at;
+  return queue->Dequeue(&queued_at);
+}
+
+
+TEST(RecompilationQueueOrder) {
+  RecompilationQueue queue(8);
+
+  queue.Enqueue(Job(1), 3, false);
+  queue.Enqueue(Job(2), 5, false);
+  queue.Enqueue(Job(3), 0, true);
+  queue.Enqueue(Job(4), 1, false);
+  queue.Enqueue(Job(5), 5, false);
+  queue.Enqueue(Job(6), 7, true);
+  queue.Enqueue(Job(7), 0, false);
+  CHECK_EQ(7, queue.length());
+
+  // OSR jobs first regardless of their ticks, then the most ticks first,
+  // and queueing order among equals.
+  CHECK_EQ(Job(3), Dequeue(&queue));
+  CHECK_EQ(Job(6), Dequeue(&queue));
+  CHECK_EQ(Job(2), Dequeue(&queue));
+  CHECK_EQ(Job(5), Dequeue(&queue));
+  CHECK_EQ(Job(1), Dequeue(&queue));
+  CHECK_EQ(Job(4), Dequeue(&queue));
+  CHECK_EQ(Job(7), Dequeue(&queue));
+  CHECK_EQ(0, queue.length());
+  CHECK_EQ(NULL, Dequeue(&queue));
+}
+
+
+TEST(RecompilationQueueInterleaved) {
+  RecompilationQueue queue(3);
+
+  queue.Enqueue(Job(1), 2, false);
+  queue.Enqueue(Job(2), 2, false);
+  queue.Enqueue(Job(3), 4, false);
+  CHECK(queue.IsFull());
+  CHECK_EQ(Job(3), Dequeue(&queue));
+  CHECK(!queue.IsFull());
+
+  // A later OSR job overtakes everything already queued, and a later job
+  // with equal ticks queues up behind the earlier ones.
+  queue.Enqueue(Job(4), 2, false);
+  CHECK_EQ(Job(1), Dequeue(&queue));
+  queue.Enqueue(Job(5), 0, true);
+  CHECK_EQ(Job(5), Dequeue(&queue));
+  CHECK_EQ(Job(2), Dequeue(&queue));
+  CHECK_EQ(Job(4), Dequeue(&queue));
+  CHECK_EQ(NULL, Dequeue(&queue));
+}
@@ -0,0 +1,99 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/v8.h"
+
+#include "src/zone.h"
+#include "test/cctest/cctest.h"
+
+using namespace v8::internal;
+
+
+// Zones on the optimizing compiler thread use the pool concurrently, so the
+// tests do not check the process-wide byte counts. They flush the pool
+// first and then only rely on the segments cached by the current thread.
+
+
+TEST(ZoneSegmentPoolSizeClasses) {
+  CHECK_EQ(ZoneSegmentPool::kMinimumPooledSegmentSize,
+           ZoneSegmentPool::RoundUpToSizeClass(1));
+  CHECK_EQ(ZoneSegmentPool::kMinimumPooledSegmentSize,
+           ZoneSegmentPool::RoundUpToSizeClass(
+               ZoneSegmentPool::kMinimumPooledSegmentSize));
+  CHECK_EQ(16 * KB, ZoneSegmentPool::RoundUpToSizeClass(8 * KB + 1));
+  CHECK_EQ(64 * KB, ZoneSegmentPool::RoundUpToSizeClass(33 * KB));
+  CHECK_EQ(ZoneSegmentPool::kMaximumPooledSegmentSize,
+           ZoneSegmentPool::RoundUpToSizeClass(
+               ZoneSegmentPool::kMaximumPooledSegmentSize));
+  // Segments larger than the largest size class are not rounded.
+  int large = ZoneSegmentPool::kMaximumPooledSegmentSize + 1;
+  CHECK_EQ(large, ZoneSegmentPool::RoundUpToSizeClass(large));
+  CHECK_EQ(1 * MB - 1, ZoneSegmentPool::RoundUpToSizeClass(1 * MB - 1));
+}
+
+
+TEST(ZoneSegmentPoolReuse) {
+  CcTest::InitializeVM();
+  ZoneSegmentPool::ReleaseUnusedSegments();
+
+  int size = 32 * KB;
+  bool reused;
+  void* segment = ZoneSegmentPool::Allocate(size, &reused);
+  ZoneSegmentPool::Free(segment, size);
+
+  // The segment went to this thread's cache, which other threads do not
+  // take from.
+  void* again = ZoneSegmentPool::Allocate(size, &reused);
+  CHECK(reused);
+  CHECK_EQ(segment, again);
+  ZoneSegmentPool::Free(again, size);
+
+  // Segments above the largest size class are never pooled.
+  int large = ZoneSegmentPool::kMaximumPooledSegmentSize + 1;
+  void* large_segment = ZoneSegmentPool::Allocate(large, &reused);
+  CHECK(!reused);
+  ZoneSegmentPool::Free(large_segment, large);
+  ZoneSegmentPool::Free(ZoneSegmentPool::Allocate(large, &reused), large);
+  CHECK(!reused);
+
+  ZoneSegmentPool::ReleaseUnusedSegments();
+}
+
+
+TEST(ZoneSegmentPoolBudget) {
+  CcTest::InitializeVM();
+  int saved_pool_size = FLAG_zone_segment_pool_size;
+  FLAG_zone_segment_pool_size = 0;
+  // Without a budget no thread can add segments after the flush.
+  ZoneSegmentPool::ReleaseUnusedSegments();
+  CHECK_EQ(0, static_cast<int>(ZoneSegmentPool::bytes_held()));
+
+  int size = 64 * KB;
+  bool reused;
+  ZoneSegmentPool::Free(ZoneSegmentPool::Allocate(size, &reused), size);
+  CHECK(!reused);
+  ZoneSegmentPool::Free(ZoneSegmentPool::Allocate(size, &reused), size);
+  CHECK(!reused);
+  CHECK_EQ(0, static_cast<int>(ZoneSegmentPool::bytes_held()));
+
+  FLAG_zone_segment_pool_size = saved_pool_size;
+}
+
+
+TEST(ZoneReusesSegments) {
+  CcTest::InitializeVM();
+  ZoneSegmentPool::ReleaseUnusedSegments();
+  {
+    Zone zone(CcTest::i_isolate());
+    for (int i = 0; i < 1000; i++) zone.New(1 * KB);
+  }
+  // The zone returned its first segment, which has the smallest size class,
+  // to this thread's cache.
+  int size = ZoneSegmentPool::kMinimumPooledSegmentSize;
+  bool reused;
+  void* segment = ZoneSegmentPool::Allocate(size, &reused);
+  CHECK(reused);
+  ZoneSegmentPool::Free(segment, size);
+  ZoneSegmentPool::ReleaseUnusedSegments();
+}
@@ -0,0 +1,87 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test Array.prototype.sort without a comparator on arrays that are sorted
+// natively, and on the ones that fall back to the JavaScript implementation.
+
+function DefaultSort(a) {
+  // Sort a copy of the array with the JavaScript implementation.
+  var copy = a.slice();
+  copy.sort(function(x, y) {
+    x = String(x);
+    y = String(y);
+    return x < y ? -1 : (x > y ? 1 : 0);
+  });
+  return copy;
+}
+
+function Check(a) {
+  var expected = DefaultSort(a);
+  assertSame(a, a.sort());
+  assertEquals(expected, a);
+}
+
+// Smis are ordered by their string representations.
+var smis = [10, 9, 1, 100, -1, -10, 0, 2, 20, -2];
+assertTrue(%HasFastSmiElements(smis));
+Check(smis);
+assertEquals([-1, -10, -2, 0, 1, 10, 100, 2, 20, 9], smis);
+
+var large = [];
+for (var i = 0; i < 1000; i++) large.push((i * 7919) % 1009 - 500);
+Check(large);
+
+// Doubles, including the special values.
+var doubles = [1.5, -0.5, 1e21, 1e-7, Infinity, -Infinity, NaN, 0.1, 10, -0];
+assertTrue(%HasFastDoubleElements(doubles));
+Check(doubles);
+assertEquals([-0.5, -Infinity, -0, 0.1, 1.5, 10, 1e21, 1e-7, Infinity, NaN],
+             doubles);
+
+// Strings, including two-byte and cons strings.
+var cons = "aa";
+for (var i = 0; i < 5; i++) cons += "b" + i;
+var strings = ["b", "a", "ሴ", "ab", "", "A", cons, "é", "aa"];
+Check(strings);
+assertEquals(["", "A", "a", "aa", cons, "ab", "b", "é", "ሴ"],
+             strings);
+
+// Holes and undefineds go to the end.
+var holey = [3, , 1, undefined, 2, , 10];
+holey.sort();
+assertEquals(7, holey.length);
+assertEquals([1, 10, 2, 3, undefined], holey.slice(0, 5));
+assertFalse(5 in holey);
+assertFalse(6 in holey);
+
+var holey_doubles = [1.5, , 0.5];
+holey_doubles.sort();
+assertEquals([0.5, 1.5], holey_doubles.slice(0, 2));
+assertFalse(2 in holey_doubles);
+
+// Arrays with mixed contents take the JavaScript path.
+var mixed = [3, "b", 1.5, "a", true, null, {}];
+Check(mixed);
+
+// A comparator is always called.
+var calls = 0;
+var numbers = [3, 1, 2];
+numbers.sort(function(x, y) { calls++; return x - y; });
+assertEquals([1, 2, 3], numbers);
+assertTrue(calls > 0);
+
+// Copy-on-write arrays are copied before they are sorted.
+function Literal() { return [3, 2, 1]; }
+var first = Literal();
+first.sort();
+assertEquals([1, 2, 3], first);
+assertEquals([3, 2, 1], Literal());
+
+// Array-likes are not affected.
+var array_like = { 0: 2, 1: 1, length: 2 };
+Array.prototype.sort.call(array_like);
+assertEquals(1, array_like[0]);
+assertEquals(2, array_like[1]);
@@ -0,0 +1,42 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+// Flags: --concurrent-recompilation-threads=3
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+function make(n) {
+  return new Function("x", "return x * " + n + " + " + n + ";");
+}
+
+var functions = [];
+for (var i = 0; i < 6; i++) {
+  var f = make(i);
+  f(1);
+  f(2);
+  functions.push(f);
+}
+
+// Queue more jobs than there are compiler threads.
+for (var i = 0; i < functions.length; i++) {
+  %OptimizeFunctionOnNextCall(functions[i], "concurrent");
+  assertEquals(3 * i, functions[i](2));  // Kick off recompilation.
+}
+
+for (var i = 0; i < functions.length; i++) {
+  assertUnoptimized(functions[i], "no sync");
+}
+
+// Let all compiler threads proceed.
+%UnblockConcurrentRecompilation();
+
+for (var i = 0; i < functions.length; i++) {
+  assertOptimized(functions[i], "sync");
+  assertEquals(4 * i, functions[i](3));
+}
@@ -0,0 +1,31 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-filter=*
+// Flags: --concurrent-recompilation --block-concurrent-recompilation
+
+if (!%IsConcurrentRecompilationSupported()) {
+  print("Concurrent recompilation is disabled. Skipping this test.");
+  quit();
+}
+
+function f(a, b) {
+  var sum = 0;
+  for (var i = 0; i < a; i++) sum += i * b;
+  return sum;
+}
+
+assertEquals(30, f(5, 3));
+assertEquals(30, f(5, 3));
+
+%OptimizeFunctionOnNextCall(f, "concurrent");
+// Kick off recompilation. Graph building and instruction selection run now,
+// register allocation is left to the background thread.
+assertEquals(45, f(10, 1));
+// Not yet optimized since concurrent recompilation is blocked.
+assertUnoptimized(f, "no sync");
+// Let concurrent recompilation proceed and install the code.
+%UnblockConcurrentRecompilation();
+assertOptimized(f, "sync");
+assertEquals(90, f(10, 2));
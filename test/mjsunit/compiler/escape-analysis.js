@@ -436,3 +436,52 @@
   delete deopt.deopt;
   field(1); field(2);
 })();
+
+
+// Test identity comparisons against a captured object.
+(function testIdentity() {
+  function constructor() {
+    this.x = 1;
+  }
+  function identity(other) {
+    var o = new constructor();
+    var self = o;
+    return (o === self) + (o === other) * 2 + o.x * 4;
+  }
+  assertEquals(5, identity({})); assertEquals(5, identity(null));
+  %OptimizeFunctionOnNextCall(identity);
+  assertEquals(5, identity({})); assertEquals(5, identity(undefined));
+})();
+
+
+// Test map checks against a captured object with polymorphic feedback.
+(function testPolymorphicMapCheck() {
+  function A() { this.x = 1; }
+  function B() { this.x = 2; this.y = 0; }
+  function get(o) { return o.x; }
+  function make() {
+    return get(new A());
+  }
+  get(new A()); get(new B());
+  assertEquals(1, make()); assertEquals(1, make());
+  %OptimizeFunctionOnNextCall(make);
+  assertEquals(1, make());
+})();
+
+
+// Test polymorphic map checks against a captured object whose map depends
+// on control flow.
+(function testPolymorphicMapCheckAfterTransition() {
+  function A() { this.x = 1; }
+  function get(o) { return o.x; }
+  function make(b) {
+    var o = new A();
+    if (b) o.y = 2;
+    return get(o);
+  }
+  var t = new A(); t.y = 0;
+  get(new A()); get(t);
+  assertEquals(1, make(false)); assertEquals(1, make(true));
+  %OptimizeFunctionOnNextCall(make);
+  assertEquals(1, make(false)); assertEquals(1, make(true));
+})();
@@ -0,0 +1,42 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbo-filter=*
+// Flags: --turbo-instruction-scheduling
+
+// Independent floating point chains that the scheduler interleaves.
+function polynomial(x, y) {
+  var a = x * x * 3.5 + x * 2.25;
+  var b = y * y * 1.5 - y / 4;
+  var c = (x + y) * (x - y);
+  return a + b * c;
+}
+
+function check(x, y) {
+  var a = x * x * 3.5 + x * 2.25;
+  var b = y * y * 1.5 - y / 4;
+  var c = (x + y) * (x - y);
+  assertEquals(a + b * c, polynomial(x, y));
+}
+
+check(1.5, 2.5);
+check(-3, 0.125);
+%OptimizeFunctionOnNextCall(polynomial);
+check(1.5, 2.5);
+check(-3, 0.125);
+check(1e10, -7.75);
+
+// Loads must not move across stores to the same object.
+function swap(o) {
+  var t = o.a;
+  o.a = o.b;
+  o.b = t;
+  return o.a * 2 + o.b;
+}
+
+var o = { a: 1, b: 10 };
+assertEquals(21, swap(o));
+%OptimizeFunctionOnNextCall(swap);
+assertEquals(12, swap(o));
+assertEquals(21, swap(o));
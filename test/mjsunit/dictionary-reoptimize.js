@@ -0,0 +1,102 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --reoptimize-dictionary-objects
+// Flags: --dictionary-reoptimize-threshold=4
+
+// Test that dictionary mode objects that are only read from go back to fast
+// properties.
+
+function make_dictionary() {
+  var o = { a: 1, b: 2, c: 3, d: 4 };
+  delete o.d;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+// The eval cache shares code between evals of the same source string, so
+// every load gets a unique source and with it a fresh load IC that misses.
+var site_count = 0;
+function load_from_new_site(o, name) {
+  return eval("o." + name + "  // site " + site_count++);
+}
+
+var config = make_dictionary();
+for (var i = 0; i < 10; i++) {
+  assertEquals(1, load_from_new_site(config, "a"));
+  assertEquals(2, load_from_new_site(config, "b"));
+}
+assertTrue(%HasFastProperties(config));
+assertEquals(1, config.a);
+assertEquals(2, config.b);
+assertEquals(3, config.c);
+assertFalse("d" in config);
+assertEquals(["a", "b", "c"], Object.keys(config));
+
+// Objects with the same properties end up on the same map.
+var first = make_dictionary();
+var second = make_dictionary();
+for (var i = 0; i < 10; i++) {
+  assertEquals(1, load_from_new_site(first, "a"));
+  assertEquals(1, load_from_new_site(second, "a"));
+}
+assertTrue(%HasFastProperties(first));
+assertTrue(%HasFastProperties(second));
+assertTrue(%HaveSameMap(first, second));
+
+// Objects are only reoptimized once.
+delete first.c;
+assertFalse(%HasFastProperties(first));
+for (var i = 0; i < 10; i++) {
+  assertEquals(2, load_from_new_site(first, "b"));
+}
+assertFalse(%HasFastProperties(first));
+
+// Attributes survive the migration.
+var ro = make_dictionary();
+Object.defineProperty(ro, "ro", { value: 5, writable: false });
+for (var i = 0; i < 10; i++) {
+  assertEquals(5, load_from_new_site(ro, "ro"));
+}
+assertTrue(%HasFastProperties(ro));
+ro.ro = 6;
+assertEquals(5, ro.ro);
+assertEquals(["a", "b", "c"], Object.keys(ro));
+
+// Objects with accessors stay in dictionary mode.
+var acc = make_dictionary();
+Object.defineProperty(acc, "getter", { get: function() { return this.a; } });
+for (var i = 0; i < 10; i++) {
+  assertEquals(1, load_from_new_site(acc, "getter"));
+}
+assertFalse(%HasFastProperties(acc));
+acc.a = 7;
+assertEquals(7, acc.getter);
+
+// So do objects that keyed stores would normalize again.
+var big = make_dictionary();
+for (var i = 0; i < 20; i++) big["p" + i] = i;
+for (var i = 0; i < 10; i++) {
+  assertEquals(3, load_from_new_site(big, "c"));
+}
+assertFalse(%HasFastProperties(big));
+
+// Objects that keep adding and removing properties stay correct.
+var churn = make_dictionary();
+for (var i = 0; i < 10; i++) {
+  churn["p" + i] = i;
+  assertEquals(i, load_from_new_site(churn, "p" + i));
+  delete churn["p" + i];
+  assertEquals(undefined, load_from_new_site(churn, "p" + i));
+}
+assertEquals(1, churn.a);
+assertEquals(["a", "b", "c"], Object.keys(churn));
+
+// Prototypes are handled separately and keep working.
+var proto = make_dictionary();
+var child = Object.create(proto);
+for (var i = 0; i < 10; i++) {
+  assertEquals(2, load_from_new_site(child, "b"));
+}
+assertEquals(3, child.c);
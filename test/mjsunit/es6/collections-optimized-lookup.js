@@ -0,0 +1,83 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test Map.prototype.get, Map.prototype.has and Set.prototype.has in
+// optimized code, where lookups with string keys are inlined.
+
+function MapGet(m, k) { return m.get(k); }
+function MapHas(m, k) { return m.has(k); }
+function SetHas(s, k) { return s.has(k); }
+
+var map = new Map();
+var set = new Set();
+var object_key = {};
+for (var i = 0; i < 100; i++) {
+  map.set("key" + i, i);
+  set.add("key" + i);
+}
+map.set(1, "one");
+map.set(object_key, "object");
+set.add(1);
+set.add(object_key);
+
+function Check() {
+  // Internalized keys.
+  assertEquals(0, MapGet(map, "key0"));
+  assertTrue(MapHas(map, "key0"));
+  assertTrue(SetHas(set, "key0"));
+
+  // Keys that are equal but not identical to the stored keys.
+  var key = "key" + 42;
+  assertEquals(42, MapGet(map, key));
+  assertTrue(MapHas(map, key));
+  assertTrue(SetHas(set, key));
+
+  // Keys whose hash has not been computed yet go to the runtime.
+  var fresh = ["k", "e", "y", "7"].join("");
+  assertEquals(7, MapGet(map, fresh));
+  assertTrue(SetHas(set, ["k", "e", "y", "8"].join("")));
+
+  // Missing keys.
+  assertEquals(undefined, MapGet(map, "missing"));
+  assertFalse(MapHas(map, "missing"));
+  assertFalse(SetHas(set, "missing"));
+
+  // Non-string keys.
+  assertEquals("one", MapGet(map, 1));
+  assertEquals("object", MapGet(map, object_key));
+  assertTrue(MapHas(map, 1));
+  assertTrue(SetHas(set, object_key));
+  assertFalse(MapHas(map, {}));
+  assertFalse(SetHas(set, 2));
+  assertEquals(undefined, MapGet(map, "1"));
+}
+
+Check();
+Check();
+%OptimizeFunctionOnNextCall(MapGet);
+%OptimizeFunctionOnNextCall(MapHas);
+%OptimizeFunctionOnNextCall(SetHas);
+Check();
+
+// Deleted entries keep their place in the bucket chains.
+for (var i = 0; i < 50; i++) {
+  map.delete("key" + i);
+  set.delete("key" + i);
+}
+assertEquals(undefined, MapGet(map, "key0"));
+assertFalse(MapHas(map, "key49"));
+assertFalse(SetHas(set, "key10"));
+assertEquals(50, MapGet(map, "key50"));
+assertTrue(SetHas(set, "key99"));
+
+// Lookups see the new table after the collection grows or is cleared.
+for (var i = 0; i < 1000; i++) map.set("new" + i, i);
+assertEquals(999, MapGet(map, "new999"));
+map.clear();
+set.clear();
+assertEquals(undefined, MapGet(map, "new999"));
+assertFalse(MapHas(map, "key50"));
+assertFalse(SetHas(set, "key99"));
@@ -0,0 +1,95 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Test conversions between typed arrays of different types and from plain
+// arrays in typed array constructors and set(), which are done natively.
+
+var types = [Uint8Array, Int8Array, Uint16Array, Int16Array, Uint32Array,
+             Int32Array, Float32Array, Float64Array, Uint8ClampedArray];
+
+var values = [0, 1, -1, 127, 128, 255, 256, -129, 32767, -32769, 65536,
+              2147483647, -2147483648, 4294967295, 4294967296, 0.5, 1.5, 2.5,
+              -0.5, 254.5, 255.5, 1e10, -1e10, 1.1, -0, Infinity, -Infinity,
+              NaN];
+
+function Expected(type, source) {
+  // Store the elements one by one.
+  var result = new type(source.length);
+  for (var i = 0; i < source.length; i++) result[i] = source[i];
+  return result;
+}
+
+function AssertSameElements(expected, actual) {
+  assertEquals(expected.length, actual.length);
+  for (var i = 0; i < expected.length; i++) {
+    assertEquals(expected[i], actual[i], "index " + i);
+  }
+}
+
+// Plain arrays of doubles and Smis.
+var doubles = values.slice();
+var smis = [0, 1, -1, 127, 128, 255, 256, -129, 32767, -32769, 65536];
+for (var t = 0; t < types.length; t++) {
+  var type = types[t];
+  AssertSameElements(Expected(type, doubles), new type(doubles));
+  AssertSameElements(Expected(type, smis), new type(smis));
+
+  var target = new type(doubles.length + 2);
+  target.set(doubles, 2);
+  AssertSameElements(Expected(type, doubles), target.subarray(2));
+  target.set(smis, 1);
+  AssertSameElements(Expected(type, smis),
+                     target.subarray(1, smis.length + 1));
+  assertThrows(function() { target.set(doubles, 3); }, RangeError);
+}
+
+// Every pair of typed array types.
+for (var s = 0; s < types.length; s++) {
+  var source = new types[s](values);
+  for (var t = 0; t < types.length; t++) {
+    var type = types[t];
+    AssertSameElements(Expected(type, source), new type(source));
+    var target = new type(source.length + 1);
+    target.set(source, 1);
+    AssertSameElements(Expected(type, source), target.subarray(1));
+  }
+}
+
+// Overlapping typed arrays of different types over the same buffer.
+for (var s = 0; s < types.length; s++) {
+  for (var t = 0; t < types.length; t++) {
+    var buffer = new ArrayBuffer(256);
+    var bytes = new Uint8Array(buffer);
+    for (var i = 0; i < bytes.length; i++) bytes[i] = i * 7;
+    var source_size = types[s].BYTES_PER_ELEMENT;
+    var target_size = types[t].BYTES_PER_ELEMENT;
+    var source = new types[s](buffer, 8 * source_size, 8);
+    var target = new types[t](buffer, 8 * target_size, 16);
+    var expected = Expected(types[t], new types[s](source));
+    target.set(source, 4);
+    AssertSameElements(expected, target.subarray(4, 12));
+  }
+}
+
+// Holes are read from the prototype chain.
+var holey = [1, , 3];
+Array.prototype[1] = 2;
+AssertSameElements([1, 2, 3], new Int8Array(holey));
+var target = new Int8Array(3);
+target.set(holey);
+AssertSameElements([1, 2, 3], target);
+delete Array.prototype[1];
+AssertSameElements([1, 0, 3], new Int8Array(holey));
+
+var holey_doubles = [1.5, , 3.5];
+AssertSameElements([1.5, NaN, 3.5], new Float64Array(holey_doubles));
+
+// Arrays with other contents are converted with ToNumber.
+var objects = [1, "2", { valueOf: function() { return 3; } }, undefined];
+AssertSameElements([1, 2, 3, NaN], new Float32Array(objects));
+
+// Typed arrays with a replaced length getter.
+var source = new Int16Array([1, 2, 3]);
+Object.defineProperty(source, "length", { value: 5 });
+AssertSameElements([1, 2, 3, 0, 0], new Int32Array(source));
@@ -0,0 +1,79 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --harmony-arrays --allow-natives-syntax --expose-gc
+
+// Test Array.prototype.fill on fast mode arrays, which are filled in place.
+
+// Smis keep the elements kind.
+var smis = [1, 2, 3, 4, 5];
+smis.fill(0, 1, 4);
+assertEquals([1, 0, 0, 0, 5], smis);
+assertTrue(%HasFastSmiElements(smis));
+
+// Heap numbers turn Smi arrays into double arrays.
+var numbers = [1, 2, 3];
+numbers.fill(1.5, 1);
+assertEquals([1, 1.5, 1.5], numbers);
+assertTrue(%HasFastDoubleElements(numbers));
+numbers.fill(NaN);
+assertTrue(isNaN(numbers[0]) && isNaN(numbers[2]));
+
+// Objects turn any array into an object array.
+var object = {};
+var doubles = [0.5, 1.5, 2.5];
+doubles.fill(object, 0, 2);
+assertSame(object, doubles[0]);
+assertSame(object, doubles[1]);
+assertEquals(2.5, doubles[2]);
+assertTrue(%HasFastObjectElements(doubles));
+
+var strings = ["a", "b", "c"];
+strings.fill("x");
+assertEquals(["x", "x", "x"], strings);
+
+// Holes are filled.
+var holey = [1, , 3, , 5];
+holey.fill(7);
+assertEquals([7, 7, 7, 7, 7], holey);
+assertTrue(3 in holey);
+
+var holey_doubles = [1.5, , 2.5];
+holey_doubles.fill(4, 1, 2);
+assertEquals([1.5, 4, 2.5], holey_doubles);
+
+// Large arrays in old space get objects from new space.
+var large = new Array(100000);
+for (var i = 0; i < large.length; i++) large[i] = i;
+gc();
+large.fill({ value: 1 });
+gc();
+assertEquals(1, large[0].value);
+assertEquals(1, large[large.length - 1].value);
+
+// Copy-on-write arrays are copied first.
+function Literal() { return [1, 2, 3]; }
+var copy = Literal();
+copy.fill(0);
+assertEquals([0, 0, 0], copy);
+assertEquals([1, 2, 3], Literal());
+
+// Setters on the prototype chain are still called for holes.
+var setter_calls = 0;
+Object.defineProperty(Array.prototype, 1, {
+  set: function(v) { setter_calls++; },
+  configurable: true
+});
+var with_setter = [1, , 3];
+with_setter.fill(0);
+assertEquals(1, setter_calls);
+assertFalse(with_setter.hasOwnProperty(1));
+delete Array.prototype[1];
+
+// Non-extensible arrays keep their holes.
+var sealed_holes = [1, , 3];
+Object.preventExtensions(sealed_holes);
+sealed_holes.fill(0);
+assertEquals(0, sealed_holes[0]);
+assertFalse(1 in sealed_holes);
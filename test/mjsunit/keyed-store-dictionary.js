@@ -0,0 +1,85 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Test the generic keyed store stub on receivers with dictionary properties.
+
+function store(obj, key, value) { obj[key] = value; }
+
+function make_dictionary() {
+  var o = { a: 1, b: 2, c: 3, d: 4 };
+  delete o.d;
+  assertFalse(%HasFastProperties(o));
+  return o;
+}
+
+// Drive the keyed store IC megamorphic with a mix of key types.
+var keys = ["a", "b", "c", 0, 1, "x" + 1, Symbol("s")];
+for (var i = 0; i < keys.length; i++) store({}, keys[i], i);
+
+// Updating existing properties.
+var o = make_dictionary();
+for (var i = 0; i < 10; i++) {
+  store(o, "a", i);
+  store(o, "b", i + 1);
+}
+assertEquals(9, o.a);
+assertEquals(10, o.b);
+assertEquals(3, o.c);
+
+// Adding properties still works.
+store(o, "new_key", 42);
+assertEquals(42, o.new_key);
+
+// Non-internalized string keys.
+var key = "ne" + "w_" + "key";
+store(o, key, 43);
+assertEquals(43, o.new_key);
+
+// Array index string keys go to the elements.
+store(o, "7", 7);
+assertEquals(7, o[7]);
+assertFalse(%HasFastProperties(o));
+
+// Symbol keys.
+var sym = Symbol("sym");
+store(o, sym, 1);
+store(o, sym, 2);
+assertEquals(2, o[sym]);
+
+// Read-only properties are not written.
+var ro = make_dictionary();
+Object.defineProperty(ro, "a", { value: 1, writable: false });
+store(ro, "a", 2);
+assertEquals(1, ro.a);
+assertThrows(function() { "use strict"; ro["a"] = 2; }, TypeError);
+
+// Accessors are called.
+var acc = make_dictionary();
+var setter_value;
+Object.defineProperty(acc, "a", { set: function(v) { setter_value = v; } });
+store(acc, "a", 5);
+assertEquals(5, setter_value);
+
+// Setters on the prototype chain are called for missing properties.
+var proto_value;
+var proto = { set p(v) { proto_value = v; } };
+var child = make_dictionary();
+child.__proto__ = proto;
+store(child, "p", 6);
+assertEquals(6, proto_value);
+assertFalse(child.hasOwnProperty("p"));
+
+// Frozen objects are not written.
+var frozen = make_dictionary();
+Object.freeze(frozen);
+store(frozen, "b", 100);
+assertEquals(2, frozen.b);
+
+// Stores to the global object.
+var global = this;
+global.global_key = 1;
+store(global, "global_key", 2);
+assertEquals(2, global_key);
@@ -0,0 +1,68 @@
+// Copyright 2014 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --max-polymorphism=4
+
+// Test load ICs that go past the polymorphism limit on receivers that all
+// extend the same shape.
+
+function load_x(o) { return o.x; }
+
+// Every object extends the previous one by one property, so all of their
+// maps are on one branch of the transition tree and share a descriptor
+// array.
+function make(n) {
+  var o = { x: n };
+  if (n > 0) o.a = 0;
+  if (n > 1) o.b = 1;
+  if (n > 2) o.c = 2;
+  if (n > 3) o.d = 3;
+  if (n > 4) o.e = 4;
+  if (n > 5) o.f = 5;
+  if (n > 6) o.g = 6;
+  if (n > 7) o.h = 7;
+  return o;
+}
+
+var objects = [];
+for (var i = 0; i < 9; i++) objects.push(make(i));
+
+for (var round = 0; round < 3; round++) {
+  for (var i = 0; i < objects.length; i++) {
+    assertEquals(i, load_x(objects[i]));
+  }
+}
+
+// Objects that do not belong to the family.
+assertEquals("other", load_x({ x: "other" }));
+assertEquals("first", load_x({ a: 1, x: "first" }));
+assertEquals(undefined, load_x({ y: 1 }));
+assertEquals(undefined, load_x(1));
+assertEquals(undefined, load_x("x"));
+
+// Prototype chain lookups still work.
+var proto = { x: "proto" };
+var child = Object.create(proto);
+assertEquals("proto", load_x(child));
+
+// Objects in the family still load the right value after the misses.
+for (var i = 0; i < objects.length; i++) {
+  assertEquals(i, load_x(objects[i]));
+}
+
+// Changing the field representation of the family.
+var d = make(100);
+d.x = 1.5;
+assertEquals(1.5, load_x(d));
+for (var i = 0; i < objects.length; i++) {
+  assertEquals(i, load_x(objects[i]));
+}
+
+// Redefining the property as an accessor on one member.
+var acc = make(200);
+Object.defineProperty(acc, "x", { get: function() { return "getter"; } });
+assertEquals("getter", load_x(acc));
+for (var i = 0; i < objects.length; i++) {
+  assertEquals(i, load_x(objects[i]));
+}
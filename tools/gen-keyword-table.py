@@ -0,0 +1,115 @@
+#!/usr/bin/env python
+#
+# Copyright 2014 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+# Generates the perfect hash table used by the scanner to recognize
+# keywords (see KeywordOrIdentifierToken in src/scanner.cc).
+#
+# The hash of a keyword of length n is
+#
+#   (n * kLengthFactor + s[0] * kFirstCharFactor + s[1]) & kTableMask
+#
+# This script searches for factors that map every keyword to a distinct
+# slot and prints the constants and the table. Rerun it and paste its
+# output into src/scanner.cc whenever the set of keywords changes.
+
+import sys
+
+# Keywords and the tokens they produce when all harmony flags are on.
+# KeywordOrIdentifierToken maps the harmony tokens back to reserved words
+# when the corresponding flag is off.
+KEYWORDS = [
+  ("break", "BREAK"),
+  ("case", "CASE"),
+  ("catch", "CATCH"),
+  ("class", "FUTURE_RESERVED_WORD"),
+  ("const", "CONST"),
+  ("continue", "CONTINUE"),
+  ("debugger", "DEBUGGER"),
+  ("default", "DEFAULT"),
+  ("delete", "DELETE"),
+  ("do", "DO"),
+  ("else", "ELSE"),
+  ("enum", "FUTURE_RESERVED_WORD"),
+  ("export", "EXPORT"),
+  ("extends", "FUTURE_RESERVED_WORD"),
+  ("false", "FALSE_LITERAL"),
+  ("finally", "FINALLY"),
+  ("for", "FOR"),
+  ("function", "FUNCTION"),
+  ("if", "IF"),
+  ("implements", "FUTURE_STRICT_RESERVED_WORD"),
+  ("import", "IMPORT"),
+  ("in", "IN"),
+  ("instanceof", "INSTANCEOF"),
+  ("interface", "FUTURE_STRICT_RESERVED_WORD"),
+  ("let", "LET"),
+  ("new", "NEW"),
+  ("null", "NULL_LITERAL"),
+  ("package", "FUTURE_STRICT_RESERVED_WORD"),
+  ("private", "FUTURE_STRICT_RESERVED_WORD"),
+  ("protected", "FUTURE_STRICT_RESERVED_WORD"),
+  ("public", "FUTURE_STRICT_RESERVED_WORD"),
+  ("return", "RETURN"),
+  ("static", "FUTURE_STRICT_RESERVED_WORD"),
+  ("super", "SUPER"),
+  ("switch", "SWITCH"),
+  ("this", "THIS"),
+  ("throw", "THROW"),
+  ("true", "TRUE_LITERAL"),
+  ("try", "TRY"),
+  ("typeof", "TYPEOF"),
+  ("var", "VAR"),
+  ("void", "VOID"),
+  ("while", "WHILE"),
+  ("with", "WITH"),
+  ("yield", "YIELD"),
+]
+
+TABLE_SIZE = 128
+
+
+def Hash(keyword, length_factor, first_char_factor):
+  return (len(keyword) * length_factor +
+          ord(keyword[0]) * first_char_factor +
+          ord(keyword[1])) & (TABLE_SIZE - 1)
+
+
+def FindFactors():
+  for length_factor in range(64):
+    for first_char_factor in range(1, 64):
+      slots = set(Hash(k, length_factor, first_char_factor)
+                  for k, _ in KEYWORDS)
+      if len(slots) == len(KEYWORDS):
+        return length_factor, first_char_factor
+  return None
+
+
+def Main():
+  factors = FindFactors()
+  if factors is None:
+    print >> sys.stderr, "No perfect hash for %d slots." % TABLE_SIZE
+    return 1
+  length_factor, first_char_factor = factors
+  table = [None] * TABLE_SIZE
+  for keyword, token in KEYWORDS:
+    table[Hash(keyword, length_factor, first_char_factor)] = (keyword, token)
+  print "static const int kKeywordTableSize = %d;" % TABLE_SIZE
+  print "static const int kKeywordLengthFactor = %d;" % length_factor
+  print "static const int kKeywordFirstCharFactor = %d;" % first_char_factor
+  print ""
+  print "static const KeywordTableEntry kKeywordTable[kKeywordTableSize] = {"
+  for entry in table:
+    if entry is None:
+      print "  { NULL, 0, Token::IDENTIFIER },"
+    else:
+      keyword, token = entry
+      print "  { \"%s\", %d, Token::%s }," % (keyword, len(keyword), token)
+  print "};"
+  return 0
+
+
+if __name__ == "__main__":
+  sys.exit(Main())